@@ -63,10 +63,7 @@ static auto on_query_complete(priam::result result, std::atomic<uint64_t>& remai
                     if (opt.has_value())
                     {
                         const auto& decimal = opt.value();
-                        const auto& blob    = decimal.varint();
-                        const auto& scale   = decimal.scale();
-                        std::cout << "value: " << std::string{reinterpret_cast<const char*>(blob.data()), blob.size()}
-                                  << " scale: " << scale << std::endl;
+                        std::cout << "value: " << decimal.to_string() << " scale: " << decimal.scale() << std::endl;
                     }
                     else
                     {
@@ -88,7 +85,9 @@ static auto on_query_complete(priam::result result, std::atomic<uint64_t>& remai
                     break;
                 case priam::data_type::timestamp:
                     std::cout << "string value: " << value.as_timestamp_date_formatted().value_or("") << std::endl;
-                    std::cout << "time_t value: " << value.as_timestamp().value_or(0) << std::endl;
+                    std::cout << "milliseconds value: "
+                              << value.as_timestamp().value_or(priam::timestamp{}).time_since_epoch().count()
+                              << std::endl;
                     break;
                 case priam::data_type::timeuuid:
                 case priam::data_type::uuid:
@@ -109,9 +108,7 @@ static auto on_query_complete(priam::result result, std::atomic<uint64_t>& remai
                     auto opt = value.as_varint();
                     if (opt.has_value())
                     {
-                        const auto& blob = opt.value();
-                        std::cout << "value: " << std::string{reinterpret_cast<const char*>(blob.data()), blob.size()}
-                                  << std::endl;
+                        std::cout << "value: " << opt.value().to_string() << std::endl;
                     }
                     else
                     {
@@ -124,7 +121,7 @@ static auto on_query_complete(priam::result result, std::atomic<uint64_t>& remai
                     auto opt = value.as_inet();
                     if (opt.has_value())
                     {
-                        std::cout << "value: " << opt.value() << std::endl;
+                        std::cout << "value: " << opt.value().to_string() << std::endl;
                     }
                     else
                     {
@@ -9,13 +9,13 @@
 using namespace std::chrono_literals;
 
 static auto again(
-    const priam::statement& stmt,
-    priam::result           result,
-    std::atomic<bool>&      stop,
-    priam::client*          client,
-    priam::prepared*        prepared,
-    std::atomic<uint64_t>&  total,
-    std::atomic<uint64_t>&  success) -> void
+    priam::result               result,
+    std::atomic<bool>&          stop,
+    priam::client*              client,
+    priam::rate_limited_client* limiter,
+    priam::prepared*            prepared,
+    std::atomic<uint64_t>&      total,
+    std::atomic<uint64_t>&      success) -> void
 {
     total.fetch_add(1, std::memory_order_relaxed);
 
@@ -26,9 +26,19 @@ static auto again(
 
     if (!stop.load(std::memory_order_relaxed))
     {
-        client->execute_statement(stmt, [&stmt, &stop, client, prepared, &total, &success](priam::result r) {
-            again(stmt, std::move(r), stop, client, prepared, total, success);
-        });
+        auto on_complete = [&stop, client, limiter, prepared, &total, &success](priam::result r) {
+            again(std::move(r), stop, client, limiter, prepared, total, success);
+        };
+
+        // Each request takes a pooled statement that is returned once the request completes.
+        if (limiter != nullptr)
+        {
+            limiter->execute_statement(prepared->acquire_statement(), std::move(on_complete));
+        }
+        else
+        {
+            client->execute_statement(prepared->acquire_statement(), std::move(on_complete));
+        }
     }
 }
 
@@ -36,7 +46,9 @@ int main(int argc, char* argv[])
 {
     if (argc < 8)
     {
-        std::cout << argv[0] << " <host> <port> <username> <password> <duration_seconds> <concurrent_requests> <query>"
+        std::cout << argv[0]
+                  << " <host> <port> <username> <password> <duration_seconds> <concurrent_requests> <query>"
+                     " [max_requests_per_second]"
                   << std::endl;
         std::exit(EXIT_FAILURE);
     }
@@ -49,6 +61,8 @@ int main(int argc, char* argv[])
     uint64_t             concurrent_requests = static_cast<uint64_t>(std::stoul(argv[6]));
 
     std::string raw_query = argv[7];
+    // 0 is unlimited.
+    double max_requests_per_second = (argc > 8) ? std::stod(argv[8]) : 0.0;
 
     auto cluster = priam::cluster::make_unique();
     cluster->add_host(std::move(host)).port(port).username_and_password(std::move(username), std::move(password));
@@ -76,23 +90,34 @@ int main(int argc, char* argv[])
         std::exit(EXIT_FAILURE);
     }
 
-    auto* client   = client_ptr.get();
-    auto* prepared = prepared_ptr.get();
-
     std::atomic<bool>     stop{false};
     std::atomic<uint64_t> total{0};
     std::atomic<uint64_t> success{0};
 
-    auto stmt = prepared_ptr->make_statement();
+    std::unique_ptr<priam::rate_limited_client> limiter_ptr{nullptr};
+    if (max_requests_per_second > 0.0)
+    {
+        limiter_ptr = std::make_unique<priam::rate_limited_client>(*client_ptr, max_requests_per_second);
+    }
+
+    auto* client   = client_ptr.get();
+    auto* limiter  = limiter_ptr.get();
+    auto* prepared = prepared_ptr.get();
 
     for (size_t i = 0; i < concurrent_requests; ++i)
     {
-        client_ptr->execute_statement(
-            stmt,
-            [&stmt, &stop, client, prepared, &total, &success](priam::result r) {
-                again(stmt, std::move(r), stop, client, prepared, total, success);
-            },
-            1s);
+        auto on_complete = [&stop, client, limiter, prepared, &total, &success](priam::result r) {
+            again(std::move(r), stop, client, limiter, prepared, total, success);
+        };
+
+        if (limiter != nullptr)
+        {
+            limiter->execute_statement(prepared->acquire_statement(), std::move(on_complete), 1s);
+        }
+        else
+        {
+            client->execute_statement(prepared->acquire_statement(), std::move(on_complete), 1s);
+        }
     }
 
     // Wait for the query complete callback to finish, or timeout
@@ -0,0 +1,91 @@
+#include <priam/priam.hpp>
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+/**
+ * Compares formatting and parsing uuids through the driver, which allocates a std::string per uuid, with the
+ * allocation free priam::to_chars() and priam::from_chars().
+ */
+
+template<typename functor_type>
+static auto measure(std::string_view name, size_t count, functor_type&& functor) -> void
+{
+    auto start    = std::chrono::steady_clock::now();
+    auto checksum = functor();
+    auto elapsed  = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start);
+
+    std::cout << name << ": " << static_cast<double>(elapsed.count()) / static_cast<double>(count) << " ns/uuid"
+              << " (checksum " << checksum << ")" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+    size_t count = (argc > 1) ? std::stoul(argv[1]) : 1'000'000;
+
+    std::mt19937_64          random{42};
+    std::vector<priam::uuid> uuids(count);
+    for (auto& uuid : uuids)
+    {
+        uuid.time_and_version   = random();
+        uuid.clock_seq_and_node = random();
+    }
+
+    std::vector<std::string> strings{};
+    strings.reserve(count);
+    for (const auto& uuid : uuids)
+    {
+        strings.push_back(priam::to_string(uuid));
+    }
+
+    measure("format cass_uuid_string + std::string", count, [&]() -> uint64_t {
+        uint64_t checksum{0};
+        for (const auto& uuid : uuids)
+        {
+            std::string output;
+            output.resize(CASS_UUID_STRING_LENGTH - 1);
+            cass_uuid_string(uuid, output.data());
+            checksum += static_cast<uint8_t>(output[35]);
+        }
+        return checksum;
+    });
+
+    measure("format priam::to_chars", count, [&]() -> uint64_t {
+        uint64_t checksum{0};
+        char     buffer[priam::uuid_string_length];
+        for (const auto& uuid : uuids)
+        {
+            priam::to_chars(buffer, uuid);
+            checksum += static_cast<uint8_t>(buffer[35]);
+        }
+        return checksum;
+    });
+
+    measure("parse cass_uuid_from_string_n", count, [&]() -> uint64_t {
+        uint64_t checksum{0};
+        for (const auto& input : strings)
+        {
+            CassUuid uuid{};
+            cass_uuid_from_string_n(input.data(), input.length(), &uuid);
+            checksum += uuid.clock_seq_and_node;
+        }
+        return checksum;
+    });
+
+    measure("parse priam::from_chars", count, [&]() -> uint64_t {
+        uint64_t checksum{0};
+        for (const auto& input : strings)
+        {
+            priam::uuid uuid{};
+            priam::from_chars(input, uuid);
+            checksum += uuid.clock_seq_and_node;
+        }
+        return checksum;
+    });
+
+    return EXIT_SUCCESS;
+}
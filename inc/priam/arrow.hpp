@@ -0,0 +1,122 @@
+#pragma once
+
+#include "priam/result.hpp"
+#include "priam/type.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <optional>
+#include <string_view>
+
+// The Arrow C data and stream interfaces, https://arrow.apache.org/docs/format/CDataInterface.html.  These
+// definitions are ABI stable and guarded so they can be included alongside Arrow's own headers.
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifndef ARROW_C_DATA_INTERFACE
+    #define ARROW_C_DATA_INTERFACE
+
+    #define ARROW_FLAG_DICTIONARY_ORDERED 1
+    #define ARROW_FLAG_NULLABLE           2
+    #define ARROW_FLAG_MAP_KEYS_SORTED    4
+
+struct ArrowSchema
+{
+    const char*         format;
+    const char*         name;
+    const char*         metadata;
+    int64_t             flags;
+    int64_t             n_children;
+    struct ArrowSchema** children;
+    struct ArrowSchema*  dictionary;
+    void (*release)(struct ArrowSchema*);
+    void* private_data;
+};
+
+struct ArrowArray
+{
+    int64_t             length;
+    int64_t             null_count;
+    int64_t             offset;
+    int64_t             n_buffers;
+    int64_t             n_children;
+    const void**        buffers;
+    struct ArrowArray** children;
+    struct ArrowArray*  dictionary;
+    void (*release)(struct ArrowArray*);
+    void* private_data;
+};
+#endif // ARROW_C_DATA_INTERFACE
+
+#ifndef ARROW_C_STREAM_INTERFACE
+    #define ARROW_C_STREAM_INTERFACE
+
+struct ArrowArrayStream
+{
+    int (*get_schema)(struct ArrowArrayStream*, struct ArrowSchema* out);
+    int (*get_next)(struct ArrowArrayStream*, struct ArrowArray* out);
+    const char* (*get_last_error)(struct ArrowArrayStream*);
+    void (*release)(struct ArrowArrayStream*);
+    void* private_data;
+};
+#endif // ARROW_C_STREAM_INTERFACE
+
+#ifdef __cplusplus
+}
+#endif
+
+namespace priam
+{
+/**
+ * The Arrow format string for each data type:
+ *
+ *     ascii, text, varchar           utf8 "u"
+ *     tinyint, smallint, int, bigint int8 "c", int16 "s", int32 "i", int64 "l"
+ *     counter                        int64 "l"
+ *     float, double                  float32 "f", float64 "g"
+ *     boolean                        bool "b"
+ *     timestamp                      timestamp[ms, UTC] "tsm:UTC"
+ *     date                           date32 "tdD"
+ *     time                           time64[ns] "ttn"
+ *     duration                       interval[month_day_nano] "tin"
+ *     uuid, timeuuid                 fixed_size_binary[16] "w:16", in network byte order
+ *     blob, inet, custom             binary "z"
+ *     varint, decimal                binary "z", their CQL encoding as Arrow decimals have a fixed scale
+ *     list, set                      list "+l"
+ *     map                            map "+m"
+ *     tuple, udt                     struct "+s"
+ *
+ * @param type The data type.
+ * @return The type's Arrow format string, the nested formats are completed by their children.
+ */
+auto to_arrow_format(data_type type) -> std::string_view;
+
+/**
+ * Exports the schema of a result as a struct with a nullable child field per column.
+ * @param result The result to describe.
+ * @param out The schema to export into, the caller owns it and must call its release callback.
+ * @throws std::runtime_error If the result failed.
+ */
+auto arrow_export_schema(const result& result, ArrowSchema* out) -> void;
+
+/**
+ * Exports every row of a result as a struct array with a child array per column.  Every value is decoded
+ * once into Arrow buffers that the array owns, fixed width columns are byte swapped in bulk.
+ * @param result The result to export, views into the array do not borrow from it.
+ * @param out The array to export into, the caller owns it and must call its release callback.
+ * @throws std::runtime_error If the result failed or a text or binary column exceeds 2GB.
+ */
+auto arrow_export_array(const result& result, ArrowArray* out) -> void;
+
+/**
+ * Exports a sequence of results, e.g. pages or token range scans of the same query, as an Arrow stream of
+ * one batch per result.  The first result is fetched immediately to export the stream's schema and every
+ * later result must have the same columns.
+ * @param next_result Called for each batch, returns std::nullopt at the end of the stream.
+ * @param out The stream to export into, the caller owns it and must call its release callback.
+ * @throws std::runtime_error If the first result failed or there are no results.
+ */
+auto arrow_export_stream(std::function<std::optional<result>()> next_result, ArrowArrayStream* out) -> void;
+
+} // namespace priam
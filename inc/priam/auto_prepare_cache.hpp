@@ -0,0 +1,122 @@
+#pragma once
+
+#include "priam/cpp_driver.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace priam
+{
+class prepared;
+
+/**
+ * A bounded least recently used cache of ad-hoc query text to prepared statements, see
+ * client::auto_prepare().  Each query is counted as it executes and once it reaches the hit threshold it
+ * is prepared asynchronously in the background, executions never wait on the prepare.  When the cache
+ * is full the least recently executed query is evicted, statements already bound against its prepared
+ * statement keep it alive.
+ */
+class auto_prepare_cache
+{
+public:
+    auto_prepare_cache() = default;
+
+    auto_prepare_cache(const auto_prepare_cache&) = delete;
+    auto_prepare_cache(auto_prepare_cache&&)      = delete;
+    auto operator=(const auto_prepare_cache&) -> auto_prepare_cache& = delete;
+    auto operator=(auto_prepare_cache &&) -> auto_prepare_cache& = delete;
+
+    ~auto_prepare_cache();
+
+    /**
+     * Enables, resizes or disables the cache.  Shrinking the cache evicts the least recently used queries.
+     * @param capacity The maximum number of distinct queries tracked, 0 disables the cache.
+     * @param hit_threshold The number of executions before a query is prepared.
+     */
+    auto configure(size_t capacity, uint32_t hit_threshold) -> void;
+
+    /**
+     * @return True if the cache is enabled.
+     */
+    auto enabled() const -> bool { return m_capacity.load(std::memory_order_relaxed) != 0; }
+
+    /**
+     * Records an execution of 'query' and starts preparing it on 'session' when it becomes hot.
+     * @param session The session to prepare the query on.
+     * @param query The ad-hoc query text.
+     * @return The prepared statement for 'query' if it has finished preparing, otherwise nullptr.
+     */
+    auto hit(CassSession* session, std::string_view query) -> std::shared_ptr<prepared>;
+
+    /**
+     * @param query The ad-hoc query text.
+     * @return The prepared statement for 'query' if it has finished preparing, otherwise nullptr.
+     *         This does not count as an execution.
+     */
+    auto find(std::string_view query) const -> std::shared_ptr<prepared>;
+
+    /**
+     * @return The number of distinct queries currently tracked.
+     */
+    auto size() const -> size_t;
+
+    /**
+     * Interns the text of an ad-hoc statement so it can be tracked without each statement keeping its own
+     * copy, statements with the same text share one copy that is released with the last of them.
+     * @param query The ad-hoc query text.
+     * @return The shared query text, or nullptr if no cache in the process is enabled.
+     */
+    static auto intern(std::string_view query) -> std::shared_ptr<const std::string>;
+
+private:
+    struct entry
+    {
+        /// The ad-hoc query text, the index references it.
+        std::string m_query;
+        /// The number of executions recorded.
+        uint32_t m_hits{0};
+        /// True once a prepare has been issued for this query.
+        bool m_preparing{false};
+        /// The prepared statement once the prepare completes.
+        std::shared_ptr<prepared> m_prepared_ptr{nullptr};
+    };
+
+    struct prepare_data
+    {
+        /// The owning cache.
+        auto_prepare_cache& m_cache;
+        /// The query being prepared.
+        std::string m_query;
+    };
+
+    /// Guards all of the members below.
+    mutable std::mutex m_mutex{};
+    /// The maximum number of tracked queries, read without the lock to skip the cache when disabled.
+    std::atomic<size_t> m_capacity{0};
+    /// The number of executions before a query is prepared.
+    uint32_t m_hit_threshold{2};
+    /// Tracked queries in most recently used order.
+    std::list<entry> m_lru{};
+    /// The tracked queries by their text.
+    std::unordered_map<std::string_view, std::list<entry>::iterator> m_index{};
+
+    /**
+     * Evicts least recently used queries until there are at most 'capacity' queries.
+     */
+    auto evict(size_t capacity) -> void;
+
+    /**
+     * Driver callback for a completed background prepare.
+     * @param prepare_future The prepare future.
+     * @param data The prepare_data for the query.
+     */
+    static auto on_prepared(CassFuture* prepare_future, void* data) -> void;
+};
+
+} // namespace priam
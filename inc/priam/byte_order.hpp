@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace priam
+{
+/**
+ * Converts arrays of big endian (network order) values, as Cassandra encodes them, to the host's byte order
+ * in place.  On little endian hosts the values are byte swapped with the widest SIMD instructions the CPU
+ * supports, detected at runtime, and a scalar loop handles the remainder.  On big endian hosts these are
+ * no-ops.
+ * @param data The values to convert.
+ * @param count The number of values in 'data'.
+ */
+auto big_endian_to_host(uint16_t* data, size_t count) -> void;
+auto big_endian_to_host(uint32_t* data, size_t count) -> void;
+auto big_endian_to_host(uint64_t* data, size_t count) -> void;
+auto big_endian_to_host(float* data, size_t count) -> void;
+auto big_endian_to_host(double* data, size_t count) -> void;
+
+inline auto big_endian_to_host(int16_t* data, size_t count) -> void
+{
+    big_endian_to_host(reinterpret_cast<uint16_t*>(data), count);
+}
+
+inline auto big_endian_to_host(int32_t* data, size_t count) -> void
+{
+    big_endian_to_host(reinterpret_cast<uint32_t*>(data), count);
+}
+
+inline auto big_endian_to_host(int64_t* data, size_t count) -> void
+{
+    big_endian_to_host(reinterpret_cast<uint64_t*>(data), count);
+}
+
+/**
+ * Converts arrays of host values to big endian in place for encoding, the byte swap is its own inverse.
+ * @param data The values to convert.
+ * @param count The number of values in 'data'.
+ */
+template<typename value_type>
+auto host_to_big_endian(value_type* data, size_t count) -> void
+{
+    big_endian_to_host(data, count);
+}
+
+} // namespace priam
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <ratio>
+#include <string>
+
+namespace priam
+{
+/**
+ * A system clock time point, the C++17 spelling of std::chrono::sys_time.
+ */
+template<typename duration_type>
+using sys_time = std::chrono::time_point<std::chrono::system_clock, duration_type>;
+
+/// A number of days.
+using days = std::chrono::duration<int32_t, std::ratio<86400>>;
+
+/// A system clock date, the C++17 spelling of std::chrono::sys_days.
+using sys_days = sys_time<days>;
+
+/// Cassandra 'timestamp', milliseconds since the unix epoch.
+using timestamp = sys_time<std::chrono::milliseconds>;
+
+/// The longest ISO-8601 timestamp to_iso8601() writes, e.g. "-292275055-05-16T16:47:04.192Z".
+constexpr size_t iso8601_max_length = 32;
+
+/**
+ * @see http://datastax.github.io/cpp-driver/topics/basics/date_and_time/
+ * @param date Cassandra 'date', days since the unix epoch offset by 2^31.
+ * @return The date.
+ */
+constexpr auto from_cql_date(uint32_t date) -> sys_days
+{
+    return sys_days{days{static_cast<int32_t>(static_cast<int64_t>(date) - (int64_t{1} << 31))}};
+}
+
+/**
+ * @param date The date.
+ * @return Cassandra 'date', days since the unix epoch offset by 2^31.
+ */
+constexpr auto to_cql_date(sys_days date) -> uint32_t
+{
+    return static_cast<uint32_t>(static_cast<int64_t>(date.time_since_epoch().count()) + (int64_t{1} << 31));
+}
+
+/**
+ * @param time Cassandra 'time', nanoseconds since midnight.
+ * @return The time of day.
+ */
+constexpr auto from_cql_time(int64_t time) -> std::chrono::nanoseconds
+{
+    return std::chrono::nanoseconds{time};
+}
+
+/**
+ * Formats a timestamp as an ISO-8601 UTC date and time with milliseconds, "2020-01-02T03:04:05.678Z", without
+ * allocating.  Years outside of 0000-9999 are written with a sign and as many digits as needed.
+ * @param first The start of the output buffer, it must hold at least iso8601_max_length characters.
+ * @param value The timestamp to format.
+ * @return One past the last character written, the output is not null terminated.
+ */
+auto to_iso8601(char* first, timestamp value) -> char*;
+
+/**
+ * @param value The timestamp to format.
+ * @return The ISO-8601 formatted timestamp, see to_iso8601(char*, timestamp).
+ */
+auto to_iso8601(timestamp value) -> std::string;
+
+} // namespace priam
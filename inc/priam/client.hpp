@@ -1,22 +1,45 @@
 #pragma once
 
+#include "priam/auto_prepare_cache.hpp"
 #include "priam/cluster.hpp"
 #include "priam/consistency.hpp"
 #include "priam/cpp_driver.hpp"
+#include "priam/prepared_registry.hpp"
+#include "priam/status.hpp"
+#include "priam/typed_prepared.hpp"
 
 #include <atomic>
 #include <chrono>
 #include <functional>
-#include <map>
 #include <memory>
 #include <string>
 #include <string_view>
+#include <tuple>
+#include <utility>
+#include <vector>
 
 namespace priam
 {
 class result;
 class prepared;
 class statement;
+struct prepared_definition;
+struct callback_data;
+
+/**
+ * The outcome of registering a single prepared statement through client::prepared_register_all().
+ */
+struct prepared_register_result
+{
+    /// The name the prepared statement was registered as.
+    std::string name;
+    /// The registered prepared statement, nullptr if registering it failed.
+    std::shared_ptr<prepared> prepared_ptr;
+    /// status::ok on success, otherwise the reason registering the prepared statement failed.
+    priam::status status;
+    /// The driver's error message if registering the prepared statement failed.
+    std::string error_message;
+};
 
 class client
 {
@@ -42,13 +65,73 @@ public:
 
     /**
      * Creates a prepared statement and registers it with the Cassandra cluster this client is connected to.
-     * @param name Name to register the prepared statement as.  Can later be fetched by this name.
+     * This is safe to call while other threads are looking up or executing prepared statements.
+     * @param name Name to register the prepared statement as.  Can later be fetched by this name.  If the name
+     *             is already registered the name continues to refer to the original prepared statement and
+     *             the returned prepared statement is not stored, its handle() is invalid.
      * @param query The raw prepared statement with '?' marks for parameter binding.
      * @throw std::runtime_error If the registering of the prepared statement fails.
      * @return A shared ownership with the Client of the Prepared statement object.
      */
     auto prepared_register(std::string name, std::string_view query) -> std::shared_ptr<prepared>;
 
+    /**
+     * Creates a typed prepared statement and registers it with the Cassandra cluster this client is connected to,
+     * see typed_prepared.  The prepared statement is only registered if its parameters match 'params_type'.
+     * @tparam params_type std::tuple of the C++ parameter types, in bind position order.
+     * @tparam columns_type std::tuple of the C++ result column types, in column order.
+     * @param name Name to register the prepared statement as, see prepared_register(name, query).
+     * @param query The raw prepared statement with '?' marks for parameter binding.
+     * @throw std::runtime_error If registering the prepared statement fails or its parameters do not match.
+     * @return The typed prepared statement.
+     */
+    template<typename params_type, typename columns_type = std::tuple<>>
+    auto prepared_register(std::string name, std::string_view query) -> typed_prepared<params_type, columns_type>
+    {
+        // Using new shared_ptr as Prepared's constructor is private but friended to Client.
+        auto                                      prepared_ptr = std::shared_ptr<prepared>(new prepared(*this, query));
+        typed_prepared<params_type, columns_type> typed{prepared_ptr};
+        m_prepared_statements.insert(std::move(name), std::move(prepared_ptr));
+        return typed;
+    }
+
+    /**
+     * Creates and registers many prepared statements at once.  All of the statements are prepared
+     * concurrently and this blocks until every one has completed, so startup pays roughly a single round
+     * trip instead of one round trip per statement.  A statement that fails to prepare does not
+     * prevent the others from being registered.  A definition whose name is already registered is not
+     * registered and reports status::client_bad_params, the name keeps referring to the original.
+     * @param definitions The names and queries of the prepared statements to register.
+     * @return The outcome of each definition, in the same order as 'definitions'.
+     */
+    auto prepared_register_all(const std::vector<prepared_definition>& definitions)
+        -> std::vector<prepared_register_result>;
+
+    /**
+     * The manifest of every prepared statement registered on this client.  The underlying cluster already
+     * prepares registered statements on every host and re-prepares them when a host comes back up, see
+     * cluster::prepare_on_up_or_add_host().  Persisting the manifest with prepared_manifest_save() lets the
+     * next process warm every statement via prepared_manifest_load() before it takes traffic.
+     * @return The name and query of every registered prepared statement in registration order.
+     */
+    auto prepared_manifest() const -> std::vector<prepared_definition>;
+
+    /**
+     * Writes this client's prepared statement manifest to a file, see prepared_manifest_write().
+     * @param path The file path to write the manifest to.
+     * @throws std::runtime_error If the file cannot be written.
+     */
+    auto prepared_manifest_save(const std::string& path) const -> void;
+
+    /**
+     * Reads a prepared statement manifest from a file and registers every statement in it concurrently,
+     * see prepared_register_all().
+     * @param path The file path to read the manifest from.
+     * @throws std::runtime_error If the file cannot be read or is malformed.
+     * @return The outcome of each definition in the manifest, in file order.
+     */
+    auto prepared_manifest_load(const std::string& path) -> std::vector<prepared_register_result>;
+
     /**
      * Gets a registered prepared statement by name.
      * @param name The registered name of the prepared statement, see prepared_register().
@@ -57,9 +140,57 @@ public:
      */
     auto prepared_lookup(const std::string& name) -> std::shared_ptr<prepared>;
 
+    /**
+     * Finds the handle of a registered prepared statement.  Hot paths should resolve the handle once
+     * and then use prepared_lookup(prepared_handle).
+     * @param name The registered name of the prepared statement, see prepared_register().
+     * @return The handle, or an invalid handle if a prepared statement has not been registered with 'name'.
+     */
+    auto prepared_find(std::string_view name) const -> prepared_handle;
+
+    /**
+     * Gets a registered prepared statement by its handle.  This is wait-free and does not touch any
+     * reference counts, the prepared statement lives as long as this client.
+     * @param handle The handle of the prepared statement, see prepared::handle() and prepared_find().
+     * @return The registered prepared statement, or nullptr if the handle is invalid.
+     */
+    auto prepared_lookup(prepared_handle handle) const noexcept -> prepared*
+    {
+        return m_prepared_statements.get(handle);
+    }
+
+    /**
+     * Enables transparently preparing frequently executed ad-hoc statements.  Once an ad-hoc query text has
+     * executed 'hit_threshold' times it is prepared in the background and held in a least recently used
+     * cache of 'capacity' queries.  Later executions of ad-hoc statements with that text and no bound
+     * parameters execute against the prepared statement instead, skipping the server side parse and
+     * allowing token aware routing.  Statements created before auto prepare is enabled are not tracked.
+     * Parameters bound to an ad-hoc statement cannot be moved to the prepared statement, make_statement()
+     * binds parameterized queries against the prepared statement once it exists.
+     * This is disabled by default and safe to call while statements are executing.
+     * @param capacity The maximum number of distinct ad-hoc queries to track, 0 disables auto preparing.
+     * @param hit_threshold The number of executions of a query before it is prepared.
+     */
+    auto auto_prepare(size_t capacity, uint32_t hit_threshold = 2) -> void;
+
+    /**
+     * @param query The ad-hoc query text.
+     * @return The auto prepared statement for 'query', or nullptr if it has not been prepared.
+     */
+    auto auto_prepared(std::string_view query) const -> std::shared_ptr<prepared>;
+
+    /**
+     * Creates a statement for 'query', bound against its auto prepared statement if it has been prepared
+     * and otherwise as an ad-hoc statement, see auto_prepare().
+     * @param query The cql query to be executed.
+     * @return A statement to bind parameters to and execute.
+     */
+    auto make_statement(std::string_view query) const -> statement;
+
     /**
      * Executes the provided statement.  THis is synchronous execution and will block until completed
-     * or the query times out.
+     * or the query times out.  A pooled statement whose request timed out is freed rather than returned to its
+     * pool, the driver may still be sending it.
      * @param statement The statement to execute.  Can be re-used via reset() after this call.
      * @param timeout The timeout for this query.  0 signals no timeout.
      * @param c The Cassandra consistency level to use for this query.
@@ -74,7 +205,8 @@ public:
      * Executes the provided statement.  This is asynchronous execution and will return immediately.
      * The on_complete_callback is called when the statement's query completes or times out.  This callback
      * is run on one of the various client driver background execution threads, not on the originating thread
-     * that called execute_statement.  Beware of race conditions in the callback!
+     * that called execute_statement.  Beware of race conditions in the callback!  A pooled statement executed
+     * through this overload is freed rather than returned to its pool, the request may outlive it.
      *
      * @param statement The statement to execute.  Can be re-used via reset() after this call.
      * @param on_complete_callback The callback to execute with the result on the query completion.
@@ -87,6 +219,23 @@ public:
         std::chrono::milliseconds          timeout = std::chrono::milliseconds{0},
         consistency                        c       = consistency::local_one) -> void;
 
+    /**
+     * Executes the provided statement asynchronously, see above.  The client takes ownership of the
+     * statement until the query completes, statements acquired from a prepared statement's pool are
+     * returned to it once the on_complete_callback has run.  This makes it safe to execute many
+     * pooled statements concurrently without allocating a new statement per request.
+     *
+     * @param statement The statement to execute, ownership is moved into the client.
+     * @param on_complete_callback The callback to execute with the result on the query completion.
+     * @param timeout The timeout for this query.  0 signals no timeout.
+     * @param c The Cassandra consistency level to use for this query, defaults to LOCAL_ONE.
+     */
+    auto execute_statement(
+        statement&&                        statement,
+        std::function<void(priam::result)> on_complete_callback,
+        std::chrono::milliseconds          timeout = std::chrono::milliseconds{0},
+        consistency                        c       = consistency::local_one) -> void;
+
     /**
      * @return The number of active requests.
      */
@@ -100,14 +249,37 @@ public:
 private:
     /// Cluster settings information.
     std::unique_ptr<cluster> m_cluster_ptr{nullptr};
+    /// Hot ad-hoc queries, must outlive the session as in flight prepares reference it.
+    auto_prepare_cache m_auto_prepare{};
     /// Client session information.
     cass_session_ptr m_cass_session_ptr{nullptr};
 
-    /// All registered prepared statements on this client indexed by their name.
-    std::map<std::string, std::shared_ptr<prepared>> m_prepared_statements{};
+    /// All registered prepared statements on this client indexed by their handle and name.
+    prepared_registry m_prepared_statements{};
     /// The number of active requests.
     std::atomic<size_t> m_active_requests{0};
 
+    /**
+     * Records an execution of an ad-hoc statement in the auto prepare cache.
+     * @param statement The statement being executed.
+     * @return A statement bound against the auto prepared statement to execute instead, or nullptr to
+     *         execute 'statement' as is.
+     */
+    auto auto_prepare_statement(const statement& statement) -> cass_statement_ptr;
+
+    /**
+     * Executes the statement asynchronously and invokes the callback data on completion.
+     * @param statement The statement to execute.
+     * @param callback_ptr The callback data, ownership is passed to the driver until the query completes.
+     * @param timeout The timeout for this query.  0 signals no timeout.
+     * @param c The Cassandra consistency level to use for this query.
+     */
+    auto execute_async(
+        const statement&               statement,
+        std::unique_ptr<callback_data> callback_ptr,
+        std::chrono::milliseconds      timeout,
+        consistency                    c) -> void;
+
     /**
      * Internal callback function that is always registered with the underlying cpp-driver.
      * @param query_future The cassandra query future object.
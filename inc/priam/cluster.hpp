@@ -119,6 +119,24 @@ public:
         std::chrono::milliseconds delay,
         uint16_t                  max_executions) -> bool;
 
+    /**
+     * Prepares statements on every host in the Cluster when they are registered instead of only the host
+     * the prepare request was routed to.  This avoids an extra round trip to re-prepare the statement the
+     * first time it executes on another host.  This is enabled by default.
+     * @param enabled Flag to enable or disable preparing on all hosts.
+     * @return True if updated.
+     */
+    auto prepare_on_all_hosts(bool enabled) -> bool;
+
+    /**
+     * Re-prepares all registered statements on a host when it comes back up or is added to the Cluster,
+     * before the host is used for queries.  This avoids latency spikes from 'unprepared' round trips after
+     * a node restarts.  This is enabled by default.
+     * @param enabled Flag to enable or disable preparing on up or added hosts.
+     * @return True if updated.
+     */
+    auto prepare_on_up_or_add_host(bool enabled) -> bool;
+
     /**
      * Sets the heartbeat interval for the hosts in the Cluster to determine if they are still responding.
      * @param interval The time interval to send a heartbeat request.
@@ -0,0 +1,1479 @@
+#pragma once
+
+#include "priam/blob.hpp"
+#include "priam/cpp_driver.hpp"
+#include "priam/decimal.hpp"
+#include "priam/duration.hpp"
+#include "priam/inet.hpp"
+#include "priam/mapping.hpp"
+#include "priam/type.hpp"
+#include "priam/varint.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace priam
+{
+/**
+ * Maps a C++ type onto the cpp-driver functions for that type at compile time, see statement::bind(),
+ * statement::bind_all() and typed_prepared.  Each specialization provides:
+ *
+ *     static auto bind(CassStatement* cass_statement, size_t position, const value_type& value) -> CassError;
+ *     static auto append(CassCollection* cass_collection, const value_type& value) -> CassError;
+ *     static auto set(CassTuple* cass_tuple, size_t index, const value_type& value) -> CassError;
+ *     static auto set(CassUserType* cass_user_type, size_t index, const value_type& value) -> CassError;
+ *     static auto accepts(const CassDataType* cass_data_type) -> bool;
+ *     static auto decode(const CassValue* cass_value) -> value_type;
+ *
+ * accepts() checks the types a value decodes from.  Codecs that decode from more types than they bind to also
+ * provide binds(), see codec_binds().
+ *
+ * decode() does not check the value's type, check the column type once with accepts() first.  Null values
+ * decode to the type's default value unless the type is a std::optional.  Views such as std::string_view
+ * and priam::blob borrow from the result they were decoded from.
+ *
+ * Supported types and the Cassandra types they bind to:
+ *     bool -> boolean, int8_t -> tinyint, int16_t -> smallint, int32_t -> int, int64_t -> bigint/counter/time,
+ *     uint32_t -> date, float -> float, double -> double, std::string/std::string_view/const char* -> text,
+ *     priam::uuid -> uuid/timeuuid, priam::inet/CassInet -> inet, priam::blob -> blob, priam::varint -> varint,
+ *     priam::decimal -> decimal,
+ *     priam::duration -> duration, std::chrono::system_clock time points -> timestamp,
+ *     std::optional<T> and std::nullopt -> T or null,
+ *     contiguous ranges (std::vector, std::array) -> list, also decoded from set,
+ *     associative containers (std::unordered_map, std::map) -> map, std::tuple -> tuple,
+ *     structs with a priam::mapping -> user defined type (decode only, bind with statement_user_type::set_all()).
+ */
+template<typename value_type, typename enable = void>
+struct codec;
+
+/**
+ * @tparam types The data types to check for.
+ * @param cass_data_type The driver's data type, can be nullptr.
+ * @return True if 'cass_data_type' is one of 'types'.
+ */
+template<data_type... types>
+auto data_type_is(const CassDataType* cass_data_type) -> bool
+{
+    auto type = to_data_type(cass_data_type);
+    return ((type == types) || ...);
+}
+
+/**
+ * @tparam value_type The type to check.
+ * True if codec<value_type> provides binds().
+ */
+template<typename value_type, typename enable = void>
+struct has_binds : std::false_type
+{
+};
+
+template<typename value_type>
+struct has_binds<value_type, std::void_t<decltype(&codec<value_type>::binds)>> : std::true_type
+{
+};
+
+/**
+ * @tparam value_type The C++ type to bind.
+ * @param cass_data_type The parameter's data type, can be nullptr.
+ * @return True if 'value_type' binds to 'cass_data_type', codec<value_type>::binds() if it is provided and
+ *         otherwise codec<value_type>::accepts().
+ */
+template<typename value_type>
+auto codec_binds(const CassDataType* cass_data_type) -> bool
+{
+    if constexpr (has_binds<value_type>::value)
+    {
+        return codec<value_type>::binds(cass_data_type);
+    }
+    else
+    {
+        return codec<value_type>::accepts(cass_data_type);
+    }
+}
+
+template<>
+struct codec<bool>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, bool value) -> CassError
+    {
+        return cass_statement_bind_bool(cass_statement, position, static_cast<cass_bool_t>(value));
+    }
+
+    static auto append(CassCollection* cass_collection, bool value) -> CassError
+    {
+        return cass_collection_append_bool(cass_collection, static_cast<cass_bool_t>(value));
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, bool value) -> CassError
+    {
+        return cass_tuple_set_bool(cass_tuple, index, static_cast<cass_bool_t>(value));
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, bool value) -> CassError
+    {
+        return cass_user_type_set_bool(cass_user_type, index, static_cast<cass_bool_t>(value));
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::boolean>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> bool
+    {
+        cass_bool_t output{};
+        cass_value_get_bool(cass_value, &output);
+        return static_cast<bool>(output);
+    }
+};
+
+template<>
+struct codec<int8_t>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, int8_t value) -> CassError
+    {
+        return cass_statement_bind_int8(cass_statement, position, value);
+    }
+
+    static auto append(CassCollection* cass_collection, int8_t value) -> CassError
+    {
+        return cass_collection_append_int8(cass_collection, value);
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, int8_t value) -> CassError
+    {
+        return cass_tuple_set_int8(cass_tuple, index, value);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, int8_t value) -> CassError
+    {
+        return cass_user_type_set_int8(cass_user_type, index, value);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::tinyint>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> int8_t
+    {
+        int8_t output{};
+        cass_value_get_int8(cass_value, &output);
+        return output;
+    }
+};
+
+template<>
+struct codec<int16_t>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, int16_t value) -> CassError
+    {
+        return cass_statement_bind_int16(cass_statement, position, value);
+    }
+
+    static auto append(CassCollection* cass_collection, int16_t value) -> CassError
+    {
+        return cass_collection_append_int16(cass_collection, value);
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, int16_t value) -> CassError
+    {
+        return cass_tuple_set_int16(cass_tuple, index, value);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, int16_t value) -> CassError
+    {
+        return cass_user_type_set_int16(cass_user_type, index, value);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::smallint>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> int16_t
+    {
+        int16_t output{};
+        cass_value_get_int16(cass_value, &output);
+        return output;
+    }
+};
+
+template<>
+struct codec<int32_t>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, int32_t value) -> CassError
+    {
+        return cass_statement_bind_int32(cass_statement, position, value);
+    }
+
+    static auto append(CassCollection* cass_collection, int32_t value) -> CassError
+    {
+        return cass_collection_append_int32(cass_collection, value);
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, int32_t value) -> CassError
+    {
+        return cass_tuple_set_int32(cass_tuple, index, value);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, int32_t value) -> CassError
+    {
+        return cass_user_type_set_int32(cass_user_type, index, value);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::int_t>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> int32_t
+    {
+        int32_t output{};
+        cass_value_get_int32(cass_value, &output);
+        return output;
+    }
+};
+
+template<>
+struct codec<int64_t>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, int64_t value) -> CassError
+    {
+        return cass_statement_bind_int64(cass_statement, position, value);
+    }
+
+    static auto append(CassCollection* cass_collection, int64_t value) -> CassError
+    {
+        return cass_collection_append_int64(cass_collection, value);
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, int64_t value) -> CassError
+    {
+        return cass_tuple_set_int64(cass_tuple, index, value);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, int64_t value) -> CassError
+    {
+        return cass_user_type_set_int64(cass_user_type, index, value);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::bigint, data_type::counter, data_type::time, data_type::timestamp>(
+            cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> int64_t
+    {
+        int64_t output{};
+        cass_value_get_int64(cass_value, &output);
+        return output;
+    }
+};
+
+template<>
+struct codec<uint32_t>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, uint32_t value) -> CassError
+    {
+        return cass_statement_bind_uint32(cass_statement, position, value);
+    }
+
+    static auto append(CassCollection* cass_collection, uint32_t value) -> CassError
+    {
+        return cass_collection_append_uint32(cass_collection, value);
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, uint32_t value) -> CassError
+    {
+        return cass_tuple_set_uint32(cass_tuple, index, value);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, uint32_t value) -> CassError
+    {
+        return cass_user_type_set_uint32(cass_user_type, index, value);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::date>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> uint32_t
+    {
+        uint32_t output{};
+        cass_value_get_uint32(cass_value, &output);
+        return output;
+    }
+};
+
+template<>
+struct codec<float>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, float value) -> CassError
+    {
+        return cass_statement_bind_float(cass_statement, position, value);
+    }
+
+    static auto append(CassCollection* cass_collection, float value) -> CassError
+    {
+        return cass_collection_append_float(cass_collection, value);
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, float value) -> CassError
+    {
+        return cass_tuple_set_float(cass_tuple, index, value);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, float value) -> CassError
+    {
+        return cass_user_type_set_float(cass_user_type, index, value);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::float_t>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> float
+    {
+        float output{};
+        cass_value_get_float(cass_value, &output);
+        return output;
+    }
+};
+
+template<>
+struct codec<double>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, double value) -> CassError
+    {
+        return cass_statement_bind_double(cass_statement, position, value);
+    }
+
+    static auto append(CassCollection* cass_collection, double value) -> CassError
+    {
+        return cass_collection_append_double(cass_collection, value);
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, double value) -> CassError
+    {
+        return cass_tuple_set_double(cass_tuple, index, value);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, double value) -> CassError
+    {
+        return cass_user_type_set_double(cass_user_type, index, value);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::double_t>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> double
+    {
+        double output{};
+        cass_value_get_double(cass_value, &output);
+        return output;
+    }
+};
+
+template<>
+struct codec<std::string_view>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, std::string_view value) -> CassError
+    {
+        return cass_statement_bind_string_n(cass_statement, position, value.data(), value.length());
+    }
+
+    static auto append(CassCollection* cass_collection, std::string_view value) -> CassError
+    {
+        return cass_collection_append_string_n(cass_collection, value.data(), value.length());
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, std::string_view value) -> CassError
+    {
+        return cass_tuple_set_string_n(cass_tuple, index, value.data(), value.length());
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, std::string_view value) -> CassError
+    {
+        return cass_user_type_set_string_n(cass_user_type, index, value.data(), value.length());
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::ascii, data_type::text, data_type::varchar>(cass_data_type);
+    }
+
+    /**
+     * The view borrows from the result and is valid for the lifetime of the result.
+     */
+    static auto decode(const CassValue* cass_value) -> std::string_view
+    {
+        const char* output{nullptr};
+        size_t      output_length{0};
+        cass_value_get_string(cass_value, &output, &output_length);
+        return std::string_view{output, output_length};
+    }
+};
+
+template<>
+struct codec<std::string> : codec<std::string_view>
+{
+    static auto decode(const CassValue* cass_value) -> std::string
+    {
+        return std::string{codec<std::string_view>::decode(cass_value)};
+    }
+};
+
+template<>
+struct codec<const char*> : codec<std::string_view>
+{
+};
+
+template<>
+struct codec<char*> : codec<std::string_view>
+{
+};
+
+template<>
+struct codec<uuid>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, uuid value) -> CassError
+    {
+        return cass_statement_bind_uuid(cass_statement, position, value);
+    }
+
+    static auto append(CassCollection* cass_collection, uuid value) -> CassError
+    {
+        return cass_collection_append_uuid(cass_collection, value);
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, uuid value) -> CassError
+    {
+        return cass_tuple_set_uuid(cass_tuple, index, value);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, uuid value) -> CassError
+    {
+        return cass_user_type_set_uuid(cass_user_type, index, value);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::uuid, data_type::timeuuid>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> uuid
+    {
+        uuid output{};
+        cass_value_get_uuid(cass_value, &output);
+        return output;
+    }
+};
+
+template<>
+struct codec<CassInet>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, CassInet value) -> CassError
+    {
+        return cass_statement_bind_inet(cass_statement, position, value);
+    }
+
+    static auto append(CassCollection* cass_collection, CassInet value) -> CassError
+    {
+        return cass_collection_append_inet(cass_collection, value);
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, CassInet value) -> CassError
+    {
+        return cass_tuple_set_inet(cass_tuple, index, value);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, CassInet value) -> CassError
+    {
+        return cass_user_type_set_inet(cass_user_type, index, value);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::inet>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> CassInet
+    {
+        CassInet output{};
+        cass_value_get_inet(cass_value, &output);
+        return output;
+    }
+};
+
+template<>
+struct codec<inet>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, const inet& value) -> CassError
+    {
+        return cass_statement_bind_inet(cass_statement, position, value.cass_inet());
+    }
+
+    static auto append(CassCollection* cass_collection, const inet& value) -> CassError
+    {
+        return cass_collection_append_inet(cass_collection, value.cass_inet());
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, const inet& value) -> CassError
+    {
+        return cass_tuple_set_inet(cass_tuple, index, value.cass_inet());
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, const inet& value) -> CassError
+    {
+        return cass_user_type_set_inet(cass_user_type, index, value.cass_inet());
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::inet>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> inet
+    {
+        CassInet output{};
+        cass_value_get_inet(cass_value, &output);
+        return inet{output};
+    }
+};
+
+template<>
+struct codec<blob>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, const blob& value) -> CassError
+    {
+        return cass_statement_bind_bytes(
+            cass_statement, position, reinterpret_cast<ptr<const cass_byte_t>>(value.data()), value.size());
+    }
+
+    static auto append(CassCollection* cass_collection, const blob& value) -> CassError
+    {
+        return cass_collection_append_bytes(
+            cass_collection, reinterpret_cast<ptr<const cass_byte_t>>(value.data()), value.size());
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, const blob& value) -> CassError
+    {
+        return cass_tuple_set_bytes(
+            cass_tuple, index, reinterpret_cast<ptr<const cass_byte_t>>(value.data()), value.size());
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, const blob& value) -> CassError
+    {
+        return cass_user_type_set_bytes(
+            cass_user_type, index, reinterpret_cast<ptr<const cass_byte_t>>(value.data()), value.size());
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::blob, data_type::varint, data_type::custom>(cass_data_type);
+    }
+
+    /**
+     * The blob borrows from the result and is valid for the lifetime of the result.
+     */
+    static auto decode(const CassValue* cass_value) -> blob
+    {
+        ptr<const cass_byte_t> bytes{nullptr};
+        size_t                 bytes_size{0};
+        cass_value_get_bytes(cass_value, &bytes, &bytes_size);
+        return blob{reinterpret_cast<ptr<const std::byte>>(bytes), bytes_size};
+    }
+};
+
+template<>
+struct codec<varint>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, const varint& value) -> CassError
+    {
+        return cass_statement_bind_bytes(
+            cass_statement, position, reinterpret_cast<ptr<const cass_byte_t>>(value.data()), value.size());
+    }
+
+    static auto append(CassCollection* cass_collection, const varint& value) -> CassError
+    {
+        return cass_collection_append_bytes(
+            cass_collection, reinterpret_cast<ptr<const cass_byte_t>>(value.data()), value.size());
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, const varint& value) -> CassError
+    {
+        return cass_tuple_set_bytes(
+            cass_tuple, index, reinterpret_cast<ptr<const cass_byte_t>>(value.data()), value.size());
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, const varint& value) -> CassError
+    {
+        return cass_user_type_set_bytes(
+            cass_user_type, index, reinterpret_cast<ptr<const cass_byte_t>>(value.data()), value.size());
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::varint>(cass_data_type);
+    }
+
+    /**
+     * The varint copies its bytes, it only allocates for values over 16 bytes.
+     */
+    static auto decode(const CassValue* cass_value) -> varint
+    {
+        ptr<const cass_byte_t> bytes{nullptr};
+        size_t                 bytes_size{0};
+        cass_value_get_bytes(cass_value, &bytes, &bytes_size);
+        return varint{reinterpret_cast<ptr<const std::byte>>(bytes), bytes_size};
+    }
+};
+
+template<>
+struct codec<decimal>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, const decimal& value) -> CassError
+    {
+        return cass_statement_bind_decimal(
+            cass_statement,
+            position,
+            reinterpret_cast<ptr<const cass_byte_t>>(value.varint().data()),
+            value.varint().size(),
+            value.scale());
+    }
+
+    static auto append(CassCollection* cass_collection, const decimal& value) -> CassError
+    {
+        return cass_collection_append_decimal(
+            cass_collection,
+            reinterpret_cast<ptr<const cass_byte_t>>(value.varint().data()),
+            value.varint().size(),
+            value.scale());
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, const decimal& value) -> CassError
+    {
+        return cass_tuple_set_decimal(
+            cass_tuple,
+            index,
+            reinterpret_cast<ptr<const cass_byte_t>>(value.varint().data()),
+            value.varint().size(),
+            value.scale());
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, const decimal& value) -> CassError
+    {
+        return cass_user_type_set_decimal(
+            cass_user_type,
+            index,
+            reinterpret_cast<ptr<const cass_byte_t>>(value.varint().data()),
+            value.varint().size(),
+            value.scale());
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::decimal>(cass_data_type);
+    }
+
+    /**
+     * The decimal copies its unscaled value, it only allocates for values over 16 bytes.
+     */
+    static auto decode(const CassValue* cass_value) -> decimal
+    {
+        ptr<const cass_byte_t> varint{nullptr};
+        size_t                 varint_size{0};
+        cass_int32_t           scale{0};
+        cass_value_get_decimal(cass_value, &varint, &varint_size, &scale);
+        return decimal{blob{reinterpret_cast<ptr<const std::byte>>(varint), varint_size}, scale};
+    }
+};
+
+template<>
+struct codec<duration>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, const duration& value) -> CassError
+    {
+        return cass_statement_bind_duration(cass_statement, position, value.months(), value.days(), value.nanos());
+    }
+
+    static auto append(CassCollection* cass_collection, const duration& value) -> CassError
+    {
+        return cass_collection_append_duration(cass_collection, value.months(), value.days(), value.nanos());
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, const duration& value) -> CassError
+    {
+        return cass_tuple_set_duration(cass_tuple, index, value.months(), value.days(), value.nanos());
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, const duration& value) -> CassError
+    {
+        return cass_user_type_set_duration(cass_user_type, index, value.months(), value.days(), value.nanos());
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::duration>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> duration
+    {
+        cass_int32_t months{0};
+        cass_int32_t days{0};
+        cass_int64_t nanos{0};
+        cass_value_get_duration(cass_value, &months, &days, &nanos);
+        return duration{months, days, nanos};
+    }
+};
+
+/**
+ * Time points bind as Cassandra timestamps, milliseconds since the unix epoch, see priam::timestamp.
+ */
+template<typename duration_type>
+struct codec<std::chrono::time_point<std::chrono::system_clock, duration_type>>
+{
+    using time_point = std::chrono::time_point<std::chrono::system_clock, duration_type>;
+
+    static auto to_millis(const time_point& value) -> int64_t
+    {
+        return static_cast<int64_t>(
+            std::chrono::duration_cast<std::chrono::milliseconds>(value.time_since_epoch()).count());
+    }
+
+    static auto bind(CassStatement* cass_statement, size_t position, const time_point& value) -> CassError
+    {
+        return cass_statement_bind_int64(cass_statement, position, to_millis(value));
+    }
+
+    static auto append(CassCollection* cass_collection, const time_point& value) -> CassError
+    {
+        return cass_collection_append_int64(cass_collection, to_millis(value));
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, const time_point& value) -> CassError
+    {
+        return cass_tuple_set_int64(cass_tuple, index, to_millis(value));
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, const time_point& value) -> CassError
+    {
+        return cass_user_type_set_int64(cass_user_type, index, to_millis(value));
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::timestamp>(cass_data_type);
+    }
+
+    static auto decode(const CassValue* cass_value) -> time_point
+    {
+        cass_int64_t millis{0};
+        cass_value_get_int64(cass_value, &millis);
+        return time_point{std::chrono::duration_cast<duration_type>(std::chrono::milliseconds{millis})};
+    }
+};
+
+template<>
+struct codec<std::nullopt_t>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, std::nullopt_t) -> CassError
+    {
+        return cass_statement_bind_null(cass_statement, position);
+    }
+
+    static auto append(CassCollection*, std::nullopt_t) -> CassError
+    {
+        // Collections cannot contain nulls.
+        return CASS_ERROR_LIB_BAD_PARAMS;
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, std::nullopt_t) -> CassError
+    {
+        return cass_tuple_set_null(cass_tuple, index);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, std::nullopt_t) -> CassError
+    {
+        return cass_user_type_set_null(cass_user_type, index);
+    }
+
+    static auto accepts(const CassDataType*) -> bool { return true; }
+};
+
+/**
+ * An empty optional binds null.
+ */
+template<typename value_type>
+struct codec<std::optional<value_type>>
+{
+    static auto bind(CassStatement* cass_statement, size_t position, const std::optional<value_type>& value)
+        -> CassError
+    {
+        return value.has_value() ? codec<value_type>::bind(cass_statement, position, value.value())
+                                 : cass_statement_bind_null(cass_statement, position);
+    }
+
+    static auto append(CassCollection* cass_collection, const std::optional<value_type>& value) -> CassError
+    {
+        // Collections cannot contain nulls.
+        return value.has_value() ? codec<value_type>::append(cass_collection, value.value())
+                                 : CASS_ERROR_LIB_BAD_PARAMS;
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, const std::optional<value_type>& value) -> CassError
+    {
+        return value.has_value() ? codec<value_type>::set(cass_tuple, index, value.value())
+                                 : cass_tuple_set_null(cass_tuple, index);
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, const std::optional<value_type>& value)
+        -> CassError
+    {
+        return value.has_value() ? codec<value_type>::set(cass_user_type, index, value.value())
+                                 : cass_user_type_set_null(cass_user_type, index);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return codec<value_type>::accepts(cass_data_type);
+    }
+
+    static auto binds(const CassDataType* cass_data_type) -> bool { return codec_binds<value_type>(cass_data_type); }
+
+    static auto decode(const CassValue* cass_value) -> std::optional<value_type>
+    {
+        if (cass_value_is_null(cass_value))
+        {
+            return std::nullopt;
+        }
+        return {codec<value_type>::decode(cass_value)};
+    }
+};
+
+/**
+ * @tparam value_type The type to check.
+ * True if 'value_type' is encoded as a fixed number of big endian bytes, collections of these bulk decode with
+ * decode_fixed_width_collection().
+ */
+template<typename value_type>
+constexpr bool is_fixed_width_v = std::is_same_v<value_type, int8_t> || std::is_same_v<value_type, int16_t> ||
+                                  std::is_same_v<value_type, int32_t> || std::is_same_v<value_type, int64_t> ||
+                                  std::is_same_v<value_type, uint32_t> || std::is_same_v<value_type, float> ||
+                                  std::is_same_v<value_type, double>;
+
+/**
+ * Bulk decodes a collection of fixed width elements without iterating it.  Each element's big endian bytes are
+ * copied into place and then byte swapped in bulk, see big_endian_to_host().
+ * @param cass_value A list, set or map value.
+ * @param outputs The output array for each item of an entry, one for lists and sets, the keys and the values
+ *                for maps.  Each array must hold 'count' elements.
+ * @param widths The width in bytes of each item of an entry, 1, 2, 4 or 8.
+ * @param items_per_entry 1 for lists and sets, 2 for maps.
+ * @param count The number of entries, cass_value_item_count().
+ * @return False if the collection is not encoded with the expected widths, the outputs are then unspecified and
+ *         the collection should be decoded element by element.
+ */
+auto decode_fixed_width_collection(
+    const CassValue* cass_value, void* const* outputs, const size_t* widths, size_t items_per_entry, size_t count)
+    -> bool;
+
+/**
+ * @tparam range_type The type to check.
+ * True if 'range_type' is a contiguous range of elements that is not a string, these bind as lists and decode
+ * from lists and sets.
+ */
+template<typename range_type, typename enable = void>
+struct is_list_range : std::false_type
+{
+};
+
+template<typename range_type>
+struct is_list_range<
+    range_type,
+    std::void_t<
+        typename range_type::value_type,
+        decltype(std::data(std::declval<const range_type&>())),
+        decltype(std::size(std::declval<const range_type&>()))>>
+    : std::bool_constant<!std::is_convertible_v<const range_type&, std::string_view>>
+{
+};
+
+template<typename range_type>
+struct codec<range_type, std::enable_if_t<is_list_range<range_type>::value>>
+{
+    using element_codec = codec<std::decay_t<typename range_type::value_type>>;
+
+    static auto make_collection(const range_type& range, cass_collection_ptr& cass_collection) -> CassError
+    {
+        cass_collection = cass_collection_ptr(cass_collection_new(CASS_COLLECTION_TYPE_LIST, std::size(range)));
+        for (const auto& element : range)
+        {
+            auto rc = element_codec::append(cass_collection.get(), element);
+            if (rc != CASS_OK)
+            {
+                return rc;
+            }
+        }
+        return CASS_OK;
+    }
+
+    static auto bind(CassStatement* cass_statement, size_t position, const range_type& range) -> CassError
+    {
+        cass_collection_ptr cass_collection{nullptr};
+        auto                rc = make_collection(range, cass_collection);
+        return (rc == CASS_OK) ? cass_statement_bind_collection(cass_statement, position, cass_collection.get())
+                               : rc;
+    }
+
+    static auto append(CassCollection* cass_collection, const range_type& range) -> CassError
+    {
+        cass_collection_ptr nested{nullptr};
+        auto                rc = make_collection(range, nested);
+        return (rc == CASS_OK) ? cass_collection_append_collection(cass_collection, nested.get()) : rc;
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, const range_type& range) -> CassError
+    {
+        cass_collection_ptr nested{nullptr};
+        auto                rc = make_collection(range, nested);
+        return (rc == CASS_OK) ? cass_tuple_set_collection(cass_tuple, index, nested.get()) : rc;
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, const range_type& range) -> CassError
+    {
+        cass_collection_ptr nested{nullptr};
+        auto                rc = make_collection(range, nested);
+        return (rc == CASS_OK) ? cass_user_type_set_collection(cass_user_type, index, nested.get()) : rc;
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::list, data_type::set>(cass_data_type) &&
+               element_codec::accepts(cass_data_type_sub_data_type(cass_data_type, 0));
+    }
+
+    /**
+     * The range is always bound as a list, the driver rejects a list bound to a set.
+     */
+    static auto binds(const CassDataType* cass_data_type) -> bool
+    {
+        using element_type = std::decay_t<typename range_type::value_type>;
+        return data_type_is<data_type::list>(cass_data_type) &&
+               codec_binds<element_type>(cass_data_type_sub_data_type(cass_data_type, 0));
+    }
+
+    /**
+     * Decodes lists and sets into ranges that can be appended to, e.g. std::vector.  A std::vector of fixed
+     * width elements is sized once and decoded in bulk.
+     */
+    static auto decode(const CassValue* cass_value) -> range_type
+    {
+        using element_type = std::decay_t<typename range_type::value_type>;
+
+        range_type output{};
+        if (cass_value_is_null(cass_value))
+        {
+            return output;
+        }
+
+        auto count = cass_value_item_count(cass_value);
+        if constexpr (is_fixed_width_v<element_type> && std::is_same_v<range_type, std::vector<element_type>>)
+        {
+            output.resize(count);
+            void* const  outputs[] = {output.data()};
+            const size_t widths[]  = {sizeof(element_type)};
+            if (decode_fixed_width_collection(cass_value, outputs, widths, 1, count))
+            {
+                return output;
+            }
+            output.clear();
+        }
+
+        output.reserve(count);
+        cass_iterator_ptr cass_iterator{cass_iterator_from_collection(cass_value)};
+        while (cass_iterator_next(cass_iterator.get()))
+        {
+            output.push_back(element_codec::decode(cass_iterator_get_value(cass_iterator.get())));
+        }
+        return output;
+    }
+};
+
+/**
+ * @tparam map_type The type to check.
+ * True if 'map_type' is an associative container of keys to values, these bind as maps.
+ */
+template<typename map_type, typename enable = void>
+struct is_map_range : std::false_type
+{
+};
+
+template<typename map_type>
+struct is_map_range<map_type, std::void_t<typename map_type::key_type, typename map_type::mapped_type>>
+    : std::true_type
+{
+};
+
+template<typename map_type>
+struct codec<map_type, std::enable_if_t<is_map_range<map_type>::value>>
+{
+    using key_type    = std::decay_t<typename map_type::key_type>;
+    using mapped_type = std::decay_t<typename map_type::mapped_type>;
+    using key_codec   = codec<key_type>;
+    using value_codec = codec<mapped_type>;
+
+    static auto make_collection(const map_type& map, cass_collection_ptr& cass_collection) -> CassError
+    {
+        cass_collection = cass_collection_ptr(cass_collection_new(CASS_COLLECTION_TYPE_MAP, map.size()));
+        for (const auto& [key, value] : map)
+        {
+            auto rc = key_codec::append(cass_collection.get(), key);
+            if (rc == CASS_OK)
+            {
+                rc = value_codec::append(cass_collection.get(), value);
+            }
+            if (rc != CASS_OK)
+            {
+                return rc;
+            }
+        }
+        return CASS_OK;
+    }
+
+    static auto bind(CassStatement* cass_statement, size_t position, const map_type& map) -> CassError
+    {
+        cass_collection_ptr cass_collection{nullptr};
+        auto                rc = make_collection(map, cass_collection);
+        return (rc == CASS_OK) ? cass_statement_bind_collection(cass_statement, position, cass_collection.get())
+                               : rc;
+    }
+
+    static auto append(CassCollection* cass_collection, const map_type& map) -> CassError
+    {
+        cass_collection_ptr nested{nullptr};
+        auto                rc = make_collection(map, nested);
+        return (rc == CASS_OK) ? cass_collection_append_collection(cass_collection, nested.get()) : rc;
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, const map_type& map) -> CassError
+    {
+        cass_collection_ptr nested{nullptr};
+        auto                rc = make_collection(map, nested);
+        return (rc == CASS_OK) ? cass_tuple_set_collection(cass_tuple, index, nested.get()) : rc;
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, const map_type& map) -> CassError
+    {
+        cass_collection_ptr nested{nullptr};
+        auto                rc = make_collection(map, nested);
+        return (rc == CASS_OK) ? cass_user_type_set_collection(cass_user_type, index, nested.get()) : rc;
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::map>(cass_data_type) &&
+               key_codec::accepts(cass_data_type_sub_data_type(cass_data_type, 0)) &&
+               value_codec::accepts(cass_data_type_sub_data_type(cass_data_type, 1));
+    }
+
+    static auto binds(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::map>(cass_data_type) &&
+               codec_binds<key_type>(cass_data_type_sub_data_type(cass_data_type, 0)) &&
+               codec_binds<mapped_type>(cass_data_type_sub_data_type(cass_data_type, 1));
+    }
+
+    /**
+     * Decodes maps straight into the container.  Fixed width keys and values are decoded in bulk before they
+     * are inserted.
+     */
+    static auto decode(const CassValue* cass_value) -> map_type
+    {
+        map_type output{};
+        if (cass_value_is_null(cass_value))
+        {
+            return output;
+        }
+
+        auto count = cass_value_item_count(cass_value);
+        if constexpr (std::is_same_v<map_type, std::unordered_map<key_type, mapped_type>>)
+        {
+            output.reserve(count);
+        }
+
+        if constexpr (is_fixed_width_v<key_type> && is_fixed_width_v<mapped_type>)
+        {
+            std::vector<key_type>    keys(count);
+            std::vector<mapped_type> values(count);
+            void* const              outputs[] = {keys.data(), values.data()};
+            const size_t             widths[]  = {sizeof(key_type), sizeof(mapped_type)};
+            if (decode_fixed_width_collection(cass_value, outputs, widths, 2, count))
+            {
+                for (size_t i = 0; i < count; ++i)
+                {
+                    output.emplace(keys[i], values[i]);
+                }
+                return output;
+            }
+        }
+
+        cass_iterator_ptr cass_iterator{cass_iterator_from_map(cass_value)};
+        while (cass_iterator_next(cass_iterator.get()))
+        {
+            output.emplace(
+                key_codec::decode(cass_iterator_get_map_key(cass_iterator.get())),
+                value_codec::decode(cass_iterator_get_map_value(cass_iterator.get())));
+        }
+        return output;
+    }
+};
+
+/**
+ * std::tuple binds as a Cassandra tuple, element by element in order.
+ */
+template<typename... element_types>
+struct codec<std::tuple<element_types...>>
+{
+    using tuple_type = std::tuple<element_types...>;
+
+    template<size_t... indexes>
+    static auto set_elements(CassTuple* cass_tuple, const tuple_type& value, std::index_sequence<indexes...>)
+        -> CassError
+    {
+        CassError rc{CASS_OK};
+        (void)(((rc = codec<std::decay_t<element_types>>::set(cass_tuple, indexes, std::get<indexes>(value))) ==
+                CASS_OK) &&
+               ...);
+        return rc;
+    }
+
+    static auto make_tuple(const tuple_type& value, cass_tuple_ptr& cass_tuple) -> CassError
+    {
+        cass_tuple = cass_tuple_ptr(cass_tuple_new(sizeof...(element_types)));
+        return set_elements(cass_tuple.get(), value, std::index_sequence_for<element_types...>{});
+    }
+
+    static auto bind(CassStatement* cass_statement, size_t position, const tuple_type& value) -> CassError
+    {
+        cass_tuple_ptr cass_tuple{nullptr};
+        auto           rc = make_tuple(value, cass_tuple);
+        return (rc == CASS_OK) ? cass_statement_bind_tuple(cass_statement, position, cass_tuple.get()) : rc;
+    }
+
+    static auto append(CassCollection* cass_collection, const tuple_type& value) -> CassError
+    {
+        cass_tuple_ptr cass_tuple{nullptr};
+        auto           rc = make_tuple(value, cass_tuple);
+        return (rc == CASS_OK) ? cass_collection_append_tuple(cass_collection, cass_tuple.get()) : rc;
+    }
+
+    static auto set(CassTuple* cass_tuple, size_t index, const tuple_type& value) -> CassError
+    {
+        cass_tuple_ptr nested{nullptr};
+        auto           rc = make_tuple(value, nested);
+        return (rc == CASS_OK) ? cass_tuple_set_tuple(cass_tuple, index, nested.get()) : rc;
+    }
+
+    static auto set(CassUserType* cass_user_type, size_t index, const tuple_type& value) -> CassError
+    {
+        cass_tuple_ptr nested{nullptr};
+        auto           rc = make_tuple(value, nested);
+        return (rc == CASS_OK) ? cass_user_type_set_tuple(cass_user_type, index, nested.get()) : rc;
+    }
+
+    template<size_t... indexes>
+    static auto accepts_elements(const CassDataType* cass_data_type, std::index_sequence<indexes...>) -> bool
+    {
+        return (codec<std::decay_t<element_types>>::accepts(cass_data_type_sub_data_type(cass_data_type, indexes)) &&
+                ...);
+    }
+
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::tuple>(cass_data_type) &&
+               cass_data_type_sub_type_count(cass_data_type) == sizeof...(element_types) &&
+               accepts_elements(cass_data_type, std::index_sequence_for<element_types...>{});
+    }
+
+    template<size_t... indexes>
+    static auto binds_elements(const CassDataType* cass_data_type, std::index_sequence<indexes...>) -> bool
+    {
+        return (codec_binds<std::decay_t<element_types>>(cass_data_type_sub_data_type(cass_data_type, indexes)) &&
+                ...);
+    }
+
+    static auto binds(const CassDataType* cass_data_type) -> bool
+    {
+        return data_type_is<data_type::tuple>(cass_data_type) &&
+               cass_data_type_sub_type_count(cass_data_type) == sizeof...(element_types) &&
+               binds_elements(cass_data_type, std::index_sequence_for<element_types...>{});
+    }
+
+    template<size_t... indexes>
+    static auto decode_elements(CassIterator* cass_iterator, tuple_type& output, std::index_sequence<indexes...>)
+        -> void
+    {
+        (void)((cass_iterator_next(cass_iterator) &&
+                (std::get<indexes>(output) =
+                     codec<std::decay_t<element_types>>::decode(cass_iterator_get_value(cass_iterator)),
+                 true)) &&
+               ...);
+    }
+
+    /**
+     * Decodes the elements in order, elements missing from the end of the value keep their default value.
+     */
+    static auto decode(const CassValue* cass_value) -> tuple_type
+    {
+        tuple_type output{};
+        if (cass_value_is_null(cass_value))
+        {
+            return output;
+        }
+
+        cass_iterator_ptr cass_iterator{cass_iterator_from_tuple(cass_value)};
+        decode_elements(cass_iterator.get(), output, std::index_sequence_for<element_types...>{});
+        return output;
+    }
+};
+
+/**
+ * @tparam value_type The type to check.
+ * True if 'value_type' is a struct described by a priam::mapping, these decode from user defined types.
+ */
+template<typename value_type, typename enable = void>
+struct is_mapped : std::false_type
+{
+};
+
+template<typename value_type>
+struct is_mapped<value_type, std::void_t<decltype(mapping<value_type>::fields)>> : std::true_type
+{
+};
+
+/// The position of a mapped member with no field in the user defined type.
+constexpr size_t user_type_field_missing = static_cast<size_t>(-1);
+
+/**
+ * Where the members of a mapped struct are in a user defined type, resolved from the type's metadata once
+ * per type rather than by searching the field names for every value.
+ */
+struct user_type_layout
+{
+    /// The keyspace of the user defined type.
+    std::string m_keyspace{};
+    /// The user defined type's name.
+    std::string m_type_name{};
+    /// The name of each field in order, results each own their metadata so layouts are matched by name.
+    std::vector<std::string> m_field_names{};
+    /// A description of each field's data type in order, including every nested sub type.
+    std::string m_field_types{};
+    /// The field position of each mapped member, user_type_field_missing if the type has no such field.
+    std::vector<size_t> m_positions{};
+    /// The mapped member of each field, user_type_field_missing if the field is not mapped.
+    std::vector<size_t> m_members{};
+    /// True once the member codecs have checked the field types.
+    bool m_checked{false};
+    /// True if every member with a field accepts the field's type, set when m_checked.
+    bool m_types_match{false};
+};
+
+/**
+ * Finds the layout of a user defined type in 'cache', resolving and caching it if it is not found.  A cached
+ * layout is only reused if the keyspace, type name and every field's name and type match, including the sub
+ * types of collections, tuples and nested user defined types.
+ * @param cache The layouts already resolved for one mapped struct.
+ * @param cass_data_type The user defined type.
+ * @param names The name of each mapped member.
+ * @param count The number of mapped members.
+ * @return The layout, it stays valid even if later lookups evict it from 'cache'.
+ */
+auto lookup_user_type_layout(
+    std::vector<std::shared_ptr<user_type_layout>>& cache,
+    const CassDataType*                             cass_data_type,
+    const std::string_view*                         names,
+    size_t                                          count) -> std::shared_ptr<user_type_layout>;
+
+template<typename value_type>
+struct codec<value_type, std::enable_if_t<is_mapped<value_type>::value>>
+{
+    static constexpr const auto& fields      = mapping<value_type>::fields;
+    static constexpr size_t      field_count = std::tuple_size_v<std::decay_t<decltype(fields)>>;
+
+    template<size_t index>
+    using member_codec = codec<typename std::tuple_element_t<index, std::decay_t<decltype(fields)>>::value_type>;
+
+    template<size_t... indexes>
+    static constexpr auto make_names(std::index_sequence<indexes...>) -> std::array<std::string_view, field_count>
+    {
+        return {std::get<indexes>(fields).name...};
+    }
+
+    template<size_t... indexes>
+    static auto members_match(
+        const CassDataType* cass_data_type, const user_type_layout& layout, std::index_sequence<indexes...>) -> bool
+    {
+        return ((layout.m_positions[indexes] == user_type_field_missing ||
+                 member_codec<indexes>::accepts(
+                     cass_data_type_sub_data_type(cass_data_type, layout.m_positions[indexes]))) &&
+                ...);
+    }
+
+    /**
+     * @return The layout of 'cass_data_type', its field types are checked against the members once.
+     */
+    static auto layout(const CassDataType* cass_data_type) -> std::shared_ptr<const user_type_layout>
+    {
+        static constexpr auto names = make_names(std::make_index_sequence<field_count>{});
+        thread_local std::vector<std::shared_ptr<user_type_layout>> cache{};
+
+        auto resolved = lookup_user_type_layout(cache, cass_data_type, names.data(), field_count);
+        if (!resolved->m_checked)
+        {
+            resolved->m_types_match =
+                members_match(cass_data_type, *resolved, std::make_index_sequence<field_count>{});
+            resolved->m_checked = true;
+        }
+        return resolved;
+    }
+
+    /**
+     * @return True if 'cass_data_type' is a user defined type with a field of a matching type for every member.
+     */
+    static auto accepts(const CassDataType* cass_data_type) -> bool
+    {
+        if (!data_type_is<data_type::udt>(cass_data_type))
+        {
+            return false;
+        }
+
+        auto resolved = layout(cass_data_type);
+        return resolved->m_types_match &&
+               std::find(resolved->m_positions.begin(), resolved->m_positions.end(), user_type_field_missing) ==
+                   resolved->m_positions.end();
+    }
+
+    template<size_t... indexes>
+    static auto decode_member(
+        size_t member, const CassValue* cass_value, value_type& output, std::index_sequence<indexes...>) -> void
+    {
+        (void)((member == indexes &&
+                (output.*(std::get<indexes>(fields).member) = member_codec<indexes>::decode(cass_value), true)) ||
+               ...);
+    }
+
+    /**
+     * Decodes each field straight into its member, unmapped fields are skipped and members without a field keep
+     * their default value.
+     * @throws std::runtime_error If a member's type does not match its field's type.
+     */
+    static auto decode(const CassValue* cass_value) -> value_type
+    {
+        value_type output{};
+        if (cass_value_is_null(cass_value))
+        {
+            return output;
+        }
+
+        // Nested decodes of the same struct may evict the layout from the cache, hold on to it.
+        auto resolved = layout(cass_value_data_type(cass_value));
+        if (!resolved->m_types_match)
+        {
+            throw std::runtime_error(
+                "priam::codec: user defined type " + resolved->m_keyspace + "." + resolved->m_type_name +
+                " has a field whose type does not match its mapped member.");
+        }
+
+        const auto&       members = resolved->m_members;
+        size_t            field{0};
+        cass_iterator_ptr cass_iterator{cass_iterator_fields_from_user_type(cass_value)};
+        while (cass_iterator_next(cass_iterator.get()))
+        {
+            if (field < members.size() && members[field] != user_type_field_missing)
+            {
+                decode_member(
+                    members[field],
+                    cass_iterator_get_user_type_field_value(cass_iterator.get()),
+                    output,
+                    std::make_index_sequence<field_count>{});
+            }
+            ++field;
+        }
+        return output;
+    }
+
+    template<size_t index>
+    static auto set_member(
+        CassUserType* cass_user_type, const CassDataType* cass_data_type, size_t position, const value_type& value)
+        -> CassError
+    {
+        using member_type = typename std::tuple_element_t<index, std::decay_t<decltype(fields)>>::value_type;
+
+        const auto& member = value.*(std::get<index>(fields).member);
+        if constexpr (is_mapped<member_type>::value)
+        {
+            // Nested user defined types are built from the field's own data type.
+            auto*              nested_type = cass_data_type_sub_data_type(cass_data_type, position);
+            cass_user_type_ptr nested{cass_user_type_new_from_data_type(nested_type)};
+            auto               rc = codec<member_type>::set_all(nested.get(), nested_type, member);
+            return (rc == CASS_OK) ? cass_user_type_set_user_type(cass_user_type, position, nested.get()) : rc;
+        }
+        else
+        {
+            return member_codec<index>::set(cass_user_type, position, member);
+        }
+    }
+
+    template<size_t... indexes>
+    static auto set_members(
+        CassUserType*           cass_user_type,
+        const CassDataType*     cass_data_type,
+        const user_type_layout& layout,
+        const value_type&       value,
+        std::index_sequence<indexes...>) -> CassError
+    {
+        CassError rc{CASS_OK};
+        (void)(((rc = (layout.m_positions[indexes] == user_type_field_missing)
+                          ? CASS_ERROR_LIB_NAME_DOES_NOT_EXIST
+                          : set_member<indexes>(cass_user_type, cass_data_type, layout.m_positions[indexes], value)) ==
+                CASS_OK) &&
+               ...);
+        return rc;
+    }
+
+    /**
+     * Sets every mapped member into the user type's fields, see statement_user_type::set_all().
+     * @param cass_user_type The user type to set the fields of.
+     * @param cass_data_type The data type 'cass_user_type' was made from.
+     * @param value The struct to set the fields from.
+     * @return CASS_OK if every member was set.
+     */
+    static auto set_all(CassUserType* cass_user_type, const CassDataType* cass_data_type, const value_type& value)
+        -> CassError
+    {
+        auto resolved = layout(cass_data_type);
+        return set_members(cass_user_type, cass_data_type, *resolved, value, std::make_index_sequence<field_count>{});
+    }
+};
+
+} // namespace priam
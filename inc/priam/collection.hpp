@@ -0,0 +1,134 @@
+#pragma once
+
+#include "priam/blob.hpp"
+#include "priam/chrono.hpp"
+#include "priam/codec.hpp"
+#include "priam/cpp_driver.hpp"
+#include "priam/decimal.hpp"
+#include "priam/duration.hpp"
+#include "priam/varint.hpp"
+
+#include <ctime>
+#include <iterator>
+#include <memory>
+#include <string_view>
+#include <type_traits>
+
+namespace priam
+{
+class statement;
+class statement_list;
+class statement_set;
+class statement_map;
+class statement_tuple;
+class statement_user_type;
+
+/**
+ * The elements of a list, set or map to bind to a statement, see statement_list, statement_set and
+ * statement_map.  Elements are encoded as they are appended.
+ */
+class statement_collection
+{
+    friend statement;
+
+public:
+    statement_collection(const statement_collection&) = delete;
+    statement_collection(statement_collection&& other) : m_cass_collection_ptr(std::move(other.m_cass_collection_ptr))
+    {
+    }
+    auto operator=(const statement_collection&) -> statement_collection& = delete;
+    auto operator=(statement_collection&& other) -> statement_collection&
+    {
+        if (std::addressof(other) != this)
+        {
+            m_cass_collection_ptr = std::move(other.m_cass_collection_ptr);
+        }
+
+        return *this;
+    }
+
+    ~statement_collection() = default;
+
+    //    auto append_custom() -> bool;
+    auto append_ascii(std::string_view data) -> bool;
+    auto append_big_int(int64_t value) -> bool;
+    auto append_blob(blob blob) -> bool;
+    auto append_boolean(bool value) -> bool;
+    auto append_counter(int64_t value) -> bool;
+    auto append_decimal(const decimal& value) -> bool;
+    auto append_double(double value) -> bool;
+    auto append_float(float value) -> bool;
+    auto append_int(int32_t value) -> bool;
+    auto append_text(std::string_view data) -> bool;
+    auto append_timestamp(priam::timestamp timestamp) -> bool;
+    auto append_timestamp(std::time_t timestamp) -> bool;
+    auto append_uuid(std::string_view uuid) -> bool;
+    auto append_varchar(std::string_view data) -> bool;
+    auto append_varint(const varint& value) -> bool;
+    auto append_time_uuid(std::string_view timeuuid) -> bool;
+    auto append_inet(std::string_view inet) -> bool;
+    auto append_date(uint32_t date) -> bool;
+    auto append_time(int64_t time) -> bool;
+    auto append_tiny_int(int8_t value) -> bool;
+    auto append_duration(duration duration) -> bool;
+    auto append_list(statement_list list) -> bool;
+    auto append_set(statement_set set) -> bool;
+    auto append_map(statement_map map) -> bool;
+    auto append_tuple(statement_tuple tuple) -> bool;
+    auto append_user_type(statement_user_type user_type) -> bool;
+
+    /**
+     * Appends a value using the driver append function for its C++ type, see priam::codec.
+     * @param value The element to append, collections cannot contain nulls.
+     * @return True if the value was appended.
+     */
+    template<typename value_type>
+    auto append(const value_type& value) -> bool
+    {
+        return codec<std::decay_t<value_type>>::append(m_cass_collection_ptr.get(), value) == CASS_OK;
+    }
+
+    /**
+     * Appends a contiguous range of elements, this still makes one driver append call per element but the
+     * append function for 'value_type' is chosen once at compile time.  Appending stops at the first element
+     * that fails.
+     * @param values The elements to append.
+     * @param count The number of elements in 'values'.
+     * @return True if every element was appended.
+     */
+    template<typename value_type>
+    auto append_range(const value_type* values, size_t count) -> bool
+    {
+        auto* cass_collection = m_cass_collection_ptr.get();
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (codec<value_type>::append(cass_collection, values[i]) != CASS_OK)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @param values A contiguous container of elements, e.g. std::vector<int64_t>, see
+     *               append_range(const value_type*, size_t).
+     * @return True if every element was appended.
+     */
+    template<typename container_type>
+    auto append_range(const container_type& values) -> bool
+    {
+        return append_range(std::data(values), std::size(values));
+    }
+
+protected:
+    /**
+     * @param type The kind of collection.
+     * @param reserve_size The approximate number of items in the collection, or entries in a map.
+     */
+    statement_collection(CassCollectionType type, size_t reserve_size);
+
+    cass_collection_ptr m_cass_collection_ptr{nullptr};
+};
+
+} // namespace priam
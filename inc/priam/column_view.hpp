@@ -0,0 +1,117 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+namespace priam
+{
+class result;
+
+/**
+ * The validity of each row in a column decoded by result::column_view().  The bitmap is least significant
+ * bit first, one bit per row, with a set bit for a non-null value.
+ */
+class column_validity
+{
+    /// Only results decode columns.
+    friend result;
+
+public:
+    /**
+     * @return The number of rows in the column.
+     */
+    auto size() const -> size_t { return m_size; }
+
+    /**
+     * @return The number of null values in the column.
+     */
+    auto null_count() const -> size_t { return m_null_count; }
+
+    /**
+     * @param row The row to check.
+     * @return True if the value at 'row' is not null.
+     */
+    auto valid(size_t row) const -> bool { return (m_validity[row / 8] >> (row % 8)) & 1U; }
+
+    /**
+     * @return The validity bitmap, least significant bit first.
+     */
+    auto validity() const -> const std::vector<uint8_t>& { return m_validity; }
+
+private:
+    /// The number of rows.
+    size_t m_size{0};
+    /// The number of null rows.
+    size_t m_null_count{0};
+    /// One bit per row, set when the row's value is not null.
+    std::vector<uint8_t> m_validity{};
+};
+
+/**
+ * A single column of every row in a result decoded into a contiguous array, see result::column_view().
+ * Null values are zero in the array and cleared in the validity bitmap.
+ * @tparam value_type The fixed width C++ type of the column.
+ */
+template<typename value_type>
+class column_view : public column_validity
+{
+    /// Only results decode columns.
+    friend result;
+
+public:
+    /**
+     * @return The value of every row, zero for null values.
+     */
+    auto values() const -> const std::vector<value_type>& { return m_values; }
+
+    /**
+     * @param row The row to fetch.
+     * @return The row's value, zero if it is null.
+     */
+    auto operator[](size_t row) const -> value_type { return m_values[row]; }
+
+private:
+    /// The value of every row.
+    std::vector<value_type> m_values{};
+};
+
+/**
+ * A text column of every row in a result decoded into a dictionary of its distinct values and an index into
+ * that dictionary for every row, see result::column_view().  The dictionary's views borrow from the result.
+ */
+template<>
+class column_view<std::string_view> : public column_validity
+{
+    /// Only results decode columns.
+    friend result;
+
+public:
+    /**
+     * @return The distinct values in the column in the order they first appear.
+     */
+    auto dictionary() const -> const std::vector<std::string_view>& { return m_dictionary; }
+
+    /**
+     * @return The dictionary index of every row, zero for null values.
+     */
+    auto indices() const -> const std::vector<int32_t>& { return m_indices; }
+
+    /**
+     * @param row The row to fetch.
+     * @return The row's value, empty if it is null.
+     */
+    auto operator[](size_t row) const -> std::string_view
+    {
+        return valid(row) ? m_dictionary[static_cast<size_t>(m_indices[row])] : std::string_view{};
+    }
+
+private:
+    /// The distinct values.
+    std::vector<std::string_view> m_dictionary{};
+    /// The dictionary index of every row.
+    std::vector<int32_t> m_indices{};
+};
+
+} // namespace priam
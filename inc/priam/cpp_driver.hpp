@@ -80,6 +80,20 @@ struct cass_collection_deleter
 
 using cass_collection_ptr = std::unique_ptr<CassCollection, cass_collection_deleter>;
 
+struct cass_tuple_deleter
+{
+    auto operator()(CassTuple* cass_tuple) -> void { cass_tuple_free(cass_tuple); }
+};
+
+using cass_tuple_ptr = std::unique_ptr<CassTuple, cass_tuple_deleter>;
+
+struct cass_user_type_deleter
+{
+    auto operator()(CassUserType* cass_user_type) -> void { cass_user_type_free(cass_user_type); }
+};
+
+using cass_user_type_ptr = std::unique_ptr<CassUserType, cass_user_type_deleter>;
+
 struct cass_uuid_gen_deleter
 {
     auto operator()(CassUuidGen* cass_uuid_gen) -> void { cass_uuid_gen_free(cass_uuid_gen); }
@@ -1,29 +1,79 @@
 #pragma once
 
 #include "priam/blob.hpp"
+#include "priam/varint.hpp"
 
 #include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
 
 namespace priam
 {
+/**
+ * Cassandra 'decimal', an arbitrary precision unscaled varint and a scale, the value is
+ * unscaled * 10^-scale.
+ */
 class decimal
 {
 public:
+    /**
+     * Zero.
+     */
+    decimal() = default;
+
+    /**
+     * @param varint The unscaled value's big endian two's complement bytes, they are copied.
+     * @param scale The number of digits after the decimal point, negative scales multiply by powers of 10.
+     */
     decimal(blob varint, int32_t scale) : m_varint(varint), m_scale(scale) {}
 
+    /**
+     * @param unscaled The unscaled value.
+     * @param scale The number of digits after the decimal point, negative scales multiply by powers of 10.
+     */
+    decimal(priam::varint unscaled, int32_t scale) : m_varint(std::move(unscaled)), m_scale(scale) {}
+
+    /**
+     * @param number A base 10 number with an optional sign, fraction and exponent, e.g. "-1234.5678" or
+     *               "1.5E-3".  The scale is the number of fraction digits less the exponent.
+     * @return The decimal, or std::nullopt if 'number' is malformed.
+     */
+    static auto from_string(std::string_view number) -> std::optional<decimal>;
+
     /**
      * @return Gets the variable integer value for the Decimal.
      */
-    auto varint() const -> const blob& { return m_varint; }
+    auto varint() const -> const priam::varint& { return m_varint; }
 
     /**
      * @return Gets the scale for the variable integer value.
      */
     auto scale() const -> int32_t { return m_scale; }
 
+    /**
+     * @return The nearest double, exact decimals of up to 15 significant digits convert with a single division.
+     */
+    auto to_double() const -> double;
+
+    /**
+     * @return The exact value without an exponent, e.g. "-1234.5678", trailing zeros within the scale are kept.
+     */
+    auto to_string() const -> std::string;
+
+    /**
+     * @return True if both the unscaled value and the scale are equal, "1.0" is not equal to "1.00".
+     */
+    auto operator==(const decimal& other) const -> bool
+    {
+        return m_scale == other.m_scale && m_varint == other.m_varint;
+    }
+    auto operator!=(const decimal& other) const -> bool { return !(*this == other); }
+
 private:
-    blob    m_varint{nullptr, 0};
-    int32_t m_scale{0};
+    priam::varint m_varint{};
+    int32_t       m_scale{0};
 };
 
 } // namespace priam
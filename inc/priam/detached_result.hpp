@@ -0,0 +1,310 @@
+#pragma once
+
+#include "priam/blob.hpp"
+#include "priam/chrono.hpp"
+#include "priam/cpp_driver.hpp"
+#include "priam/decimal.hpp"
+#include "priam/duration.hpp"
+#include "priam/inet.hpp"
+#include "priam/status.hpp"
+#include "priam/type.hpp"
+#include "priam/uuid.hpp"
+#include "priam/varint.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <new>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace priam
+{
+class result;
+class detached_result;
+class detached_row;
+
+/**
+ * A single value of a detached_result, see value.  Text and bytes are borrowed from the detached result.
+ */
+class detached_value
+{
+    /// For private constructor.
+    friend detached_row;
+
+public:
+    /**
+     * @return True if the value is null.
+     */
+    auto is_null() const -> bool;
+
+    /**
+     * @return The data type of the value's column.
+     */
+    auto type() const -> data_type;
+
+    /**
+     * @tparam d The data type to check.
+     * @return True if this value's column is of type 'd'.
+     */
+    template<data_type d>
+    auto is() const -> bool
+    {
+        return type() == d;
+    }
+
+    auto as_boolean() const -> std::optional<bool>;
+    auto as_tiny_int() const -> std::optional<int8_t>;
+    auto as_small_int() const -> std::optional<int16_t>;
+    auto as_int() const -> std::optional<int32_t>;
+    auto as_big_int() const -> std::optional<int64_t>;
+    auto as_counter() const -> std::optional<int64_t>;
+    auto as_float() const -> std::optional<float>;
+    auto as_double() const -> std::optional<double>;
+    auto as_date() const -> std::optional<uint32_t>;
+    auto as_sys_days() const -> std::optional<sys_days>;
+    auto as_time() const -> std::optional<int64_t>;
+    auto as_time_of_day() const -> std::optional<std::chrono::nanoseconds>;
+    auto as_timestamp() const -> std::optional<timestamp>;
+    auto as_uuid() const -> std::optional<uuid>;
+    auto as_time_uuid() const -> std::optional<uuid>;
+    auto as_inet() const -> std::optional<inet>;
+    auto as_duration() const -> std::optional<duration>;
+    auto as_decimal() const -> std::optional<decimal>;
+    auto as_varint() const -> std::optional<varint>;
+    auto as_ascii() const -> std::optional<std::string>;
+    auto as_ascii_view() const -> std::optional<std::string_view>;
+    auto as_text() const -> std::optional<std::string>;
+    auto as_text_view() const -> std::optional<std::string_view>;
+    auto as_varchar() const -> std::optional<std::string>;
+    auto as_varchar_view() const -> std::optional<std::string_view>;
+
+    /**
+     * @return The value's encoded bytes for any variable length type, e.g. blob, text, collections, tuples and
+     *         user defined types.  std::nullopt for fixed width types and null values.
+     */
+    auto as_blob() const -> std::optional<blob>;
+
+private:
+    const detached_result* m_result{nullptr};
+    size_t                 m_column{0};
+    size_t                 m_row{0};
+
+    detached_value(const detached_result* result, size_t column, size_t row)
+        : m_result(result),
+          m_column(column),
+          m_row(row)
+    {
+    }
+
+    /**
+     * Copies a fixed width value out of the arena if the column is one of 'types'.
+     */
+    template<typename value_type, data_type... types>
+    auto fixed() const -> std::optional<value_type>;
+};
+
+/**
+ * A single row of a detached_result, see row.
+ */
+class detached_row
+{
+    /// For private constructor.
+    friend detached_result;
+
+public:
+    /**
+     * @param index The column index.
+     * @return The value at 'index', which must be less than column_count().
+     */
+    auto column(size_t index) const -> detached_value { return detached_value{m_result, index, m_row}; }
+
+    /**
+     * @param name The column name.
+     * @throws std::runtime_error If there is no column named 'name'.
+     * @return The value of the column named 'name'.
+     */
+    auto column(std::string_view name) const -> detached_value;
+
+    /**
+     * @return The number of columns in the row.
+     */
+    auto column_count() const -> size_t;
+
+    /**
+     * Calls 'value_callback' with each value in column order.  The parameter is 'const priam::detached_value&'.
+     */
+    template<typename functor_type>
+    auto for_each(functor_type&& value_callback) const -> void
+    {
+        auto count = column_count();
+        for (size_t i = 0; i < count; ++i)
+        {
+            const detached_value value{m_result, i, m_row};
+            value_callback(value);
+        }
+    }
+
+private:
+    const detached_result* m_result{nullptr};
+    size_t                 m_row{0};
+
+    detached_row(const detached_result* result, size_t row) : m_result(result), m_row(row) {}
+};
+
+/**
+ * An owned copy of a result that no longer needs the driver, see result::detach().  Every value is copied into
+ * a single block from a std::pmr::memory_resource: fixed width columns are stored column major in host byte
+ * order, all other values in one byte heap with an offset per value, each column has a validity bitmap.  A
+ * detached result is far smaller than the driver's buffers and can be cached and shared between threads for
+ * reading.
+ */
+class detached_result
+{
+    /// For private constructor.
+    friend result;
+    /// Rows and values read straight from the arena.
+    friend detached_row;
+    friend detached_value;
+
+public:
+    /**
+     * An empty result with no rows or columns.
+     */
+    detached_result() = default;
+    detached_result(const detached_result&) = delete;
+    detached_result(detached_result&& other) noexcept;
+    auto operator=(const detached_result&) -> detached_result& = delete;
+    auto operator=(detached_result&& other) noexcept -> detached_result&;
+    ~detached_result();
+
+    /**
+     * @return The status of the query the result was detached from.
+     */
+    auto status() const -> priam::status { return m_status; }
+
+    /**
+     * @return True if the result has zero rows.
+     */
+    auto empty() const -> bool { return m_row_count == 0; }
+
+    /**
+     * @return The number of rows.
+     */
+    auto size() const -> size_t { return m_row_count; }
+
+    /**
+     * @return The number of rows.
+     */
+    auto row_count() const -> size_t { return m_row_count; }
+
+    /**
+     * @return The number of columns in each row.
+     */
+    auto column_count() const -> size_t { return m_column_count; }
+
+    /**
+     * @param index The column index.
+     * @return The column's name.
+     */
+    auto column_name(size_t index) const -> std::string_view;
+
+    /**
+     * @param index The column index.
+     * @return The column's data type.
+     */
+    auto column_type(size_t index) const -> data_type;
+
+    /**
+     * @param name The column name.
+     * @return The index of the column, or std::nullopt if there is no column named 'name'.
+     */
+    auto column_index(std::string_view name) const -> std::optional<size_t>;
+
+    /**
+     * @param index The row index, must be less than row_count().
+     * @return The row at 'index'.
+     */
+    auto row_at(size_t index) const -> detached_row { return detached_row{this, index}; }
+
+    /**
+     * @return The first row, be sure to check size() >= 1 before calling.
+     */
+    auto first_row() const -> detached_row { return row_at(0); }
+
+    /**
+     * Calls 'row_callback' with each row in order.  The parameter is 'const priam::detached_row&'.
+     */
+    template<typename functor_type>
+    auto for_each(functor_type&& row_callback) const -> void
+    {
+        for (size_t i = 0; i < m_row_count; ++i)
+        {
+            const detached_row row{this, i};
+            row_callback(row);
+        }
+    }
+
+    /**
+     * @return The number of bytes allocated from the memory resource for every row, column and name.
+     */
+    auto memory_size() const -> size_t { return m_arena_size; }
+
+private:
+    /// Where a column's values are in the arena.
+    struct column_layout
+    {
+        /// The column's data type.
+        data_type m_type{data_type::unknown};
+        /// The width of each value for fixed width columns, 0 for values stored in the heap.
+        size_t m_width{0};
+        /// The arena offset of the values of fixed width columns, otherwise of row_count() + 1 heap offsets.
+        size_t m_values{0};
+        /// The arena offset of the validity bitmap, one bit per row, set for non-null values.
+        size_t m_validity{0};
+        /// The arena offset of the column name.
+        size_t m_name{0};
+        /// The length of the column name.
+        size_t m_name_length{0};
+    };
+
+    /// The memory resource the arena was allocated from.
+    std::pmr::memory_resource* m_memory_resource{nullptr};
+    /// Every column layout, value, name and heap byte.
+    std::byte* m_arena{nullptr};
+    /// The size of the arena in bytes.
+    size_t m_arena_size{0};
+    /// The arena offset of the byte heap.
+    size_t m_heap{0};
+    /// The number of rows.
+    size_t m_row_count{0};
+    /// The number of columns.
+    size_t m_column_count{0};
+    /// The status of the query the result was detached from.
+    priam::status m_status{status::ok};
+
+    /**
+     * Copies every row of 'cass_result' into a single block allocated from 'memory_resource'.
+     * @param cass_result The driver's result, can be nullptr.
+     * @param status The status of the query.
+     * @param memory_resource The resource to allocate the block from.
+     */
+    detached_result(const CassResult* cass_result, priam::status status, std::pmr::memory_resource* memory_resource);
+
+    auto layout(size_t column) const -> const column_layout&
+    {
+        return std::launder(reinterpret_cast<const column_layout*>(m_arena))[column];
+    }
+
+    auto is_valid(size_t column, size_t row) const -> bool;
+
+    /**
+     * @return The bytes of a value stored in the heap.
+     */
+    auto heap_value(size_t column, size_t row) const -> blob;
+
+    auto release() -> void;
+};
+
+} // namespace priam
@@ -1,6 +1,8 @@
 #pragma once
 
+#include <chrono>
 #include <cstdint>
+#include <optional>
 
 namespace priam
 {
@@ -24,6 +26,26 @@ public:
      */
     auto nanos() const -> int64_t { return m_nanos; }
 
+    /**
+     * Months have no fixed length so only durations without months convert, days are 24 hours.
+     * @return The duration in nanoseconds, or std::nullopt if it has months or does not fit.
+     */
+    auto to_chrono() const -> std::optional<std::chrono::nanoseconds>
+    {
+        constexpr int64_t nanos_per_day = 86'400'000'000'000;
+        if (m_months != 0 || m_days > INT64_MAX / nanos_per_day || m_days < INT64_MIN / nanos_per_day)
+        {
+            return std::nullopt;
+        }
+
+        int64_t total{0};
+        if (__builtin_add_overflow(int64_t{m_days} * nanos_per_day, m_nanos, &total))
+        {
+            return std::nullopt;
+        }
+        return std::chrono::nanoseconds{total};
+    }
+
 private:
     const int32_t m_months{0};
     const int32_t m_days{0};
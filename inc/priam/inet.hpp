@@ -0,0 +1,86 @@
+#pragma once
+
+#include "priam/cpp_driver.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+namespace priam
+{
+/**
+ * An IPv4 or IPv6 address in network byte order, as stored by Cassandra's 'inet' type.
+ */
+class inet
+{
+public:
+    /// The longest formatted address, an IPv4 mapped IPv6 address "ffff:ffff:ffff:ffff:ffff:ffff:255.255.255.255".
+    static constexpr size_t max_string_length = 45;
+
+    inet() = default;
+
+    /**
+     * @param cass_inet The driver's address.
+     */
+    explicit inet(const CassInet& cass_inet) : m_cass_inet(cass_inet) {}
+
+    /**
+     * @param address The address in network byte order.
+     * @param size The size of the address, 4 for IPv4 or 16 for IPv6.
+     */
+    inet(const uint8_t* address, size_t size);
+
+    /**
+     * @param address An IPv4 or IPv6 address, e.g. "127.0.0.1" or "::1".
+     * @return The address, or std::nullopt if it is malformed.
+     */
+    static auto from_string(std::string_view address) -> std::optional<inet>;
+
+    /**
+     * @return The address in network byte order.
+     */
+    auto data() const -> const uint8_t* { return m_cass_inet.address; }
+
+    /**
+     * @return The size of the address, 4 for IPv4 or 16 for IPv6.
+     */
+    auto size() const -> size_t { return m_cass_inet.address_length; }
+
+    /**
+     * @return True if this is an IPv4 address.
+     */
+    auto is_v4() const -> bool { return size() == CASS_INET_V4_LENGTH; }
+
+    /**
+     * @return True if this is an IPv6 address.
+     */
+    auto is_v6() const -> bool { return size() == CASS_INET_V6_LENGTH; }
+
+    /**
+     * @return The driver's address.
+     */
+    auto cass_inet() const -> const CassInet& { return m_cass_inet; }
+
+    /**
+     * Formats the address without allocating, IPv6 addresses are formatted per RFC 5952.
+     * @param first The start of the output buffer, it must hold at least max_string_length characters.
+     * @return One past the last character written, the output is not null terminated.
+     */
+    auto to_chars(char* first) const -> char*;
+
+    /**
+     * @return The formatted address, see to_chars().
+     */
+    auto to_string() const -> std::string;
+
+    auto operator==(const inet& other) const -> bool;
+    auto operator!=(const inet& other) const -> bool { return !(*this == other); }
+
+private:
+    /// The address, an empty address has a zero length.
+    CassInet m_cass_inet{{0}, 0};
+};
+
+} // namespace priam
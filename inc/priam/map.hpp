@@ -1,5 +1,6 @@
 #pragma once
 
+#include "priam/collection.hpp"
 #include "priam/cpp_driver.hpp"
 #include "priam/value.hpp"
 
@@ -43,4 +44,54 @@ private:
     explicit map(const CassValue* cass_value);
 };
 
+/**
+ * The entries of a Cassandra 'map' to bind to a statement, see statement::bind_map().  The append_*()
+ * functions alternate between a key and its value.
+ */
+class statement_map : public statement_collection
+{
+public:
+    /**
+     * @param reserve_size The approximate number of entries in the map.
+     */
+    explicit statement_map(size_t reserve_size);
+
+    using statement_collection::append;
+    using statement_collection::append_range;
+
+    /**
+     * @param key The entry's key.
+     * @param value The entry's value.
+     * @return True if the entry was appended.
+     */
+    template<typename key_type, typename mapped_type>
+    auto append(const key_type& key, const mapped_type& value) -> bool
+    {
+        return append(key) && append(value);
+    }
+
+    /**
+     * Appends 'count' entries from parallel arrays of keys and values, one driver append call per key and
+     * value, see statement_collection::append_range().
+     * @param keys The entries' keys.
+     * @param values The entries' values.
+     * @param count The number of entries.
+     * @return True if every entry was appended.
+     */
+    template<typename key_type, typename mapped_type>
+    auto append_range(const key_type* keys, const mapped_type* values, size_t count) -> bool
+    {
+        auto* cass_collection = m_cass_collection_ptr.get();
+        for (size_t i = 0; i < count; ++i)
+        {
+            if (codec<key_type>::append(cass_collection, keys[i]) != CASS_OK ||
+                codec<mapped_type>::append(cass_collection, values[i]) != CASS_OK)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+};
+
 } // namespace priam
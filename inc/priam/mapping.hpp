@@ -0,0 +1,54 @@
+#pragma once
+
+#include <string_view>
+#include <tuple>
+
+namespace priam
+{
+/**
+ * Describes how a struct maps onto the columns of a result, see result::as<T>(), or the fields of a user defined
+ * type.  Specialize it for a struct
+ * with a static constexpr 'fields' tuple of priam::field() entries, one per mapped member:
+ *
+ *     struct user { priam::uuid id; std::string name; std::optional<int32_t> age; };
+ *
+ *     template<>
+ *     struct priam::mapping<user>
+ *     {
+ *         static constexpr auto fields = std::make_tuple(
+ *             priam::field("id", &user::id), priam::field("name", &user::name), priam::field("age", &user::age));
+ *     };
+ *
+ * The same mapping decodes user defined types with value::as_udt<T>(), the names are then the type's field names.
+ * Each member type must have a priam::codec specialization, the mapped struct must be default constructible.
+ * @tparam value_type The struct to map.
+ */
+template<typename value_type>
+struct mapping;
+
+/**
+ * A single column to member mapping, see priam::field().
+ */
+template<typename class_type, typename member_type>
+struct field_mapping
+{
+    using value_type = member_type;
+
+    /// The column name.
+    std::string_view name;
+    /// The member the column is decoded into.
+    member_type class_type::*member;
+};
+
+/**
+ * @param name The column name.
+ * @param member The member the column is decoded into.
+ * @return The column to member mapping.
+ */
+template<typename class_type, typename member_type>
+constexpr auto field(std::string_view name, member_type class_type::*member) -> field_mapping<class_type, member_type>
+{
+    return field_mapping<class_type, member_type>{name, member};
+}
+
+} // namespace priam
@@ -1,15 +1,33 @@
 #pragma once
 
+#include "priam/auto_prepare_cache.hpp"
 #include "priam/cpp_driver.hpp"
+#include "priam/prepared_registry.hpp"
 #include "priam/statement.hpp"
+#include "priam/type.hpp"
 
 #include <memory>
+#include <optional>
+#include <string>
 #include <string_view>
+#include <utility>
+#include <vector>
 
 namespace priam
 {
 class client;
 
+/**
+ * A named query to register as a prepared statement, see client::prepared_register_all().
+ */
+struct prepared_definition
+{
+    /// The name to register the prepared statement as.
+    std::string name;
+    /// The prepared statement query.
+    std::string query;
+};
+
 class prepared : public std::enable_shared_from_this<prepared>
 {
     /**
@@ -17,6 +35,13 @@ class prepared : public std::enable_shared_from_this<prepared>
      * can create prepared objects correctly.
      */
     friend client;
+    /// The registry assigns the prepared statement its handle.
+    friend prepared_registry;
+    /// The auto prepare cache creates prepared statements for hot ad-hoc queries.
+    friend auto_prepare_cache;
+    /// Typed prepared statements check their parameter types against the underlying prepared object.
+    template<typename, typename>
+    friend class typed_prepared;
 
 public:
     prepared(const prepared&) = delete;
@@ -29,6 +54,82 @@ public:
      */
     auto make_statement() const -> statement;
 
+    /**
+     * Acquires a statement from this prepared statement's pool instead of binding a new one.  The
+     * statement is reset and returned to the pool when it is destroyed, pass it to
+     * client::execute_statement(statement&&, ...) to have it returned once the request completes.
+     * This is safe to call concurrently from any thread.
+     * @return A statement with no parameters bound.
+     */
+    auto acquire_statement() const -> statement;
+
+    /**
+     * Acquires a statement from the pool and binds every argument to it in order, see statement::bind_all().
+     * @param arg The value to bind to position 0.
+     * @param args The values to bind to the following positions.
+     * @return The statement and status::ok if every value was bound, otherwise the status of the first failure.
+     */
+    template<typename arg_type, typename... args_type>
+    auto make_statement(const arg_type& arg, const args_type&... args) const -> std::pair<statement, status>
+    {
+        auto s  = acquire_statement();
+        auto rc = s.bind_all(arg, args...);
+        return {std::move(s), rc};
+    }
+
+    /**
+     * @return The number of idle statements in this prepared statement's pool.
+     */
+    auto pooled_statements() const -> size_t { return m_statement_pool->size(); }
+
+    /**
+     * @return The number of parameters to bind to this prepared statement, from the server's metadata.
+     */
+    auto parameter_count() const -> size_t { return m_parameter_count; }
+
+    /**
+     * @param position The bind position.
+     * @return The name of the parameter, for '?' markers this is the name of the column it binds to.
+     */
+    auto parameter_name(size_t position) const -> std::string_view { return m_parameters[position].m_name; }
+
+    /**
+     * @param position The bind position.
+     * @return The data type of the parameter.
+     */
+    auto parameter_type(size_t position) const -> data_type { return m_parameters[position].m_type; }
+
+    /**
+     * @param position The bind position.
+     * @return The driver's full data type of the parameter, including the element types of collections and the
+     *         fields of user defined types, see statement_user_type.  It is valid for the lifetime of this
+     *         prepared statement.
+     */
+    auto parameter_data_type(size_t position) const -> const CassDataType*
+    {
+        return cass_prepared_parameter_data_type(m_cass_prepared_ptr.get(), position);
+    }
+
+    /**
+     * Resolves a parameter name to its bind position.  Binding by position is O(1) while every statement
+     * bind_*(value, name) overload searches the parameters by name, so resolve names once and bind
+     * with the position in hot paths.  If a name appears more than once the first position is returned.
+     * @param name The parameter name, a ':name' marker or the name of the column a '?' marker binds to.
+     * @return The bind position of 'name', or std::nullopt if there is no parameter with that name.
+     */
+    auto bind_index(std::string_view name) const -> std::optional<size_t>;
+
+    /**
+     * @return The handle this prepared statement is registered under on its client, see
+     *         client::prepared_lookup(prepared_handle).
+     */
+    auto handle() const -> prepared_handle { return m_handle; }
+
+    /**
+     * @return The query this prepared statement was created from.
+     */
+    auto query() const -> const std::string& { return m_query; }
+
 private:
     /**
      * @param client The client that owns this prepared statement.
@@ -37,10 +138,37 @@ private:
      */
     prepared(client& client, std::string_view query);
 
+    /**
+     * @param cass_prepared The underlying cassandra prepared object, ownership is moved into the prepared statement.
+     * @param query The prepared statement query.
+     */
+    prepared(cass_prepared_ptr cass_prepared, std::string_view query);
+
+    /**
+     * Reads the parameter metadata from the underlying cassandra prepared object and creates the statement pool.
+     */
+    auto initialize() -> void;
+
+    struct parameter
+    {
+        /// The parameter name.
+        std::string m_name;
+        /// The parameter data type.
+        data_type m_type;
+    };
+
     /// The underlying cassandra prepared object.
     cass_prepared_ptr m_cass_prepared_ptr{nullptr};
+    /// The query this prepared statement was created from.
+    std::string m_query{};
     /// The number of parameters to bind to this prepared statement.
     size_t m_parameter_count{0};
+    /// The name and type of every parameter in bind position order.
+    std::vector<parameter> m_parameters{};
+    /// The handle this prepared statement is registered under.
+    prepared_handle m_handle{};
+    /// Reusable statements, shared with acquired statements so they can be returned after this is destroyed.
+    std::shared_ptr<statement_pool> m_statement_pool{nullptr};
 };
 
 } // namespace priam
@@ -0,0 +1,55 @@
+#pragma once
+
+#include "priam/prepared.hpp"
+
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace priam
+{
+/**
+ * A prepared statement manifest is the list of names and queries registered on a client, see
+ * client::prepared_manifest().  Persisting it lets a freshly started process prepare every statement
+ * before it takes traffic instead of paying a prepare round trip on first use.
+ *
+ * The format is one definition per line, "name<TAB>query".  Tabs, newlines, carriage returns and
+ * backslashes in either field are escaped with a backslash, as is a '#' starting a name.  Empty lines
+ * and lines starting with '#' are ignored.
+ */
+
+/**
+ * Writes the manifest to the stream.
+ * @param out The stream to write to.
+ * @param definitions The prepared statement definitions to write.
+ * @throws std::runtime_error If a definition has an empty name or writing to the stream fails.
+ */
+auto prepared_manifest_write(std::ostream& out, const std::vector<prepared_definition>& definitions) -> void;
+
+/**
+ * Writes the manifest to the file at 'path', replacing it if it already exists.
+ * @param path The file path to write to.
+ * @param definitions The prepared statement definitions to write.
+ * @throws std::runtime_error If a definition has an empty name or the file cannot be written.
+ */
+auto prepared_manifest_write(const std::string& path, const std::vector<prepared_definition>& definitions)
+    -> void;
+
+/**
+ * Reads a manifest from the stream.
+ * @param in The stream to read from.
+ * @throws std::runtime_error If a line is malformed.
+ * @return The prepared statement definitions in the order they were written.
+ */
+auto prepared_manifest_read(std::istream& in) -> std::vector<prepared_definition>;
+
+/**
+ * Reads a manifest from the file at 'path'.
+ * @param path The file path to read from.
+ * @throws std::runtime_error If the file cannot be opened or a line is malformed.
+ * @return The prepared statement definitions in the order they were written.
+ */
+auto prepared_manifest_read(const std::string& path) -> std::vector<prepared_definition>;
+
+} // namespace priam
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace priam
+{
+class prepared;
+class prepared_registry;
+struct prepared_definition;
+
+/**
+ * A stable index to a prepared statement registered with a client.  Handles are never invalidated
+ * for the lifetime of the client and resolve to their prepared statement without hashing strings
+ * or touching reference counts, see client::prepared_lookup(prepared_handle).
+ */
+class prepared_handle
+{
+    /// Only the registry hands out valid handles.
+    friend prepared_registry;
+
+public:
+    /**
+     * Creates an invalid handle.
+     */
+    prepared_handle() = default;
+
+    /**
+     * @return True if this handle refers to a registered prepared statement.
+     */
+    auto valid() const -> bool { return m_index != invalid_index; }
+
+    /**
+     * @return The registration index of this handle, prepared statements are indexed in the order they are
+     *         registered starting at 0.
+     */
+    auto index() const -> uint32_t { return m_index; }
+
+    auto operator==(const prepared_handle& other) const -> bool { return m_index == other.m_index; }
+    auto operator!=(const prepared_handle& other) const -> bool { return !(*this == other); }
+
+private:
+    static constexpr uint32_t invalid_index = std::numeric_limits<uint32_t>::max();
+
+    /// The slot of the prepared statement in the registry.
+    uint32_t m_index{invalid_index};
+
+    explicit prepared_handle(uint32_t index) : m_index(index) {}
+};
+
+/**
+ * The prepared statements registered on a client.  Registration is serialized with a mutex while all
+ * reads are wait-free and can run concurrently with registration:
+ *
+ * 1) Prepared statements are stored in append only chunks that never move, so a handle resolves to its
+ *    prepared statement with two atomic loads.
+ * 2) Names are interned in an insert only open addressing hash table.  When the table needs to grow a larger
+ *    copy is published and the old table is retired, readers still using it see a consistent, if slightly
+ *    stale, view.  Retired tables are released when the registry is destroyed, the geometric growth bounds
+ *    them to the size of the current table.
+ */
+class prepared_registry
+{
+public:
+    prepared_registry();
+
+    prepared_registry(const prepared_registry&) = delete;
+    prepared_registry(prepared_registry&&)      = delete;
+    auto operator=(const prepared_registry&) -> prepared_registry& = delete;
+    auto operator=(prepared_registry &&) -> prepared_registry& = delete;
+
+    ~prepared_registry();
+
+    /**
+     * Registers the prepared statement and assigns it a handle.  If 'name' is already registered nothing is
+     * stored, the prepared statement keeps an invalid handle and the name continues to refer to the original.
+     * @param name The name to register the prepared statement as.
+     * @param prepared_ptr The prepared statement, the registry shares ownership for its lifetime.
+     * @throws std::length_error If the registry is full.
+     * @return The handle for the prepared statement, or the handle 'name' is already registered under.
+     */
+    auto insert(std::string name, std::shared_ptr<prepared> prepared_ptr) -> prepared_handle;
+
+    /**
+     * @param name The registered name of the prepared statement.
+     * @return The handle of the prepared statement registered as 'name' or an invalid handle if it doesn't exist.
+     */
+    auto find(std::string_view name) const -> prepared_handle;
+
+    /**
+     * @param handle The handle of a prepared statement in this registry.
+     * @return The prepared statement, or nullptr if the handle is invalid.
+     */
+    auto get(prepared_handle handle) const noexcept -> prepared*
+    {
+        if (handle.m_index >= m_size.load(std::memory_order_acquire))
+        {
+            return nullptr;
+        }
+
+        auto [chunk, offset] = locate(handle.m_index);
+        return m_chunks[chunk].load(std::memory_order_acquire)[offset].load(std::memory_order_acquire);
+    }
+
+    /**
+     * @return The name and query of every registered name in registration order.
+     */
+    auto definitions() const -> std::vector<prepared_definition>;
+
+    /**
+     * @return The number of registered prepared statements.
+     */
+    auto size() const -> size_t { return m_size.load(std::memory_order_acquire); }
+
+private:
+    /// The number of slots in the first chunk, each following chunk doubles in size.
+    static constexpr size_t chunk_base_size = 64;
+    /// The maximum number of chunks, this allows for roughly 64 million prepared statements.
+    static constexpr size_t chunk_count = 20;
+
+    struct entry
+    {
+        /// The registered name.
+        std::string m_name;
+        /// Ownership of the prepared statement.
+        std::shared_ptr<prepared> m_prepared_ptr;
+        /// The handle assigned to the prepared statement.
+        prepared_handle m_handle;
+    };
+
+    struct name_table
+    {
+        explicit name_table(size_t capacity);
+
+        /// Open addressing slots, a null slot ends a probe sequence.
+        std::unique_ptr<std::atomic<const entry*>[]> m_slots;
+        /// capacity - 1, the capacity is always a power of 2.
+        size_t m_mask;
+        /// The number of occupied slots, only accessed by the writer.
+        size_t m_used{0};
+
+        auto find(std::string_view name) const -> const entry*;
+        auto insert(const entry* e) -> void;
+    };
+
+    /// Serializes registration and reading the entries.
+    mutable std::mutex m_writer_mutex{};
+    /// Owns every registered entry, only accessed by the writer.
+    std::vector<std::unique_ptr<entry>> m_entries{};
+    /// Owns the chunk storage, only accessed by the writer.
+    std::vector<std::unique_ptr<std::atomic<prepared*>[]>> m_chunk_storage{};
+    /// Owns the current and every retired name table, only accessed by the writer.
+    std::vector<std::unique_ptr<name_table>> m_name_tables{};
+
+    /// Published chunks, chunk i holds chunk_base_size << i slots.
+    std::array<std::atomic<std::atomic<prepared*>*>, chunk_count> m_chunks{};
+    /// The published name table.
+    std::atomic<const name_table*> m_names{nullptr};
+    /// The number of published prepared statements.
+    std::atomic<uint32_t> m_size{0};
+
+    /**
+     * @param index A registration index.
+     * @return The chunk and offset within the chunk of the index.
+     */
+    static auto locate(uint32_t index) noexcept -> std::pair<size_t, size_t>
+    {
+        // Bias the index so chunk boundaries land on powers of 2.
+        auto biased = static_cast<uint64_t>(index) + chunk_base_size;
+        auto msb    = static_cast<size_t>(63 - __builtin_clzll(biased));
+        auto chunk  = msb - 6; // log2(chunk_base_size)
+        return {chunk, static_cast<size_t>(biased - (uint64_t{chunk_base_size} << chunk))};
+    }
+};
+
+} // namespace priam
@@ -1,17 +1,37 @@
 #pragma once
 
+#include "priam/arrow.hpp"
+#include "priam/auto_prepare_cache.hpp"
 #include "priam/blob.hpp"
+#include "priam/byte_order.hpp"
+#include "priam/chrono.hpp"
 #include "priam/client.hpp"
 #include "priam/cluster.hpp"
+#include "priam/codec.hpp"
+#include "priam/collection.hpp"
+#include "priam/column_view.hpp"
 #include "priam/consistency.hpp"
 #include "priam/cpp_driver.hpp"
+#include "priam/detached_result.hpp"
+#include "priam/inet.hpp"
 #include "priam/list.hpp"
 #include "priam/map.hpp"
+#include "priam/mapping.hpp"
 #include "priam/prepared.hpp"
+#include "priam/prepared_manifest.hpp"
+#include "priam/prepared_registry.hpp"
+#include "priam/rate_limited_client.hpp"
+#include "priam/rate_limiter.hpp"
 #include "priam/result.hpp"
 #include "priam/row.hpp"
 #include "priam/set.hpp"
 #include "priam/statement.hpp"
+#include "priam/statement_pool.hpp"
+#include "priam/tuple.hpp"
 #include "priam/type.hpp"
+#include "priam/typed_prepared.hpp"
+#include "priam/user_type.hpp"
+#include "priam/uuid.hpp"
 #include "priam/uuid_generator.hpp"
 #include "priam/value.hpp"
+#include "priam/varint.hpp"
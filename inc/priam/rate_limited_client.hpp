@@ -0,0 +1,184 @@
+#pragma once
+
+#include "priam/client.hpp"
+#include "priam/consistency.hpp"
+#include "priam/rate_limiter.hpp"
+#include "priam/statement.hpp"
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace priam
+{
+class result;
+
+/**
+ * Wraps a client and caps the rate of statements executed through it with a requests per second
+ * and a bytes per second token bucket.  This is intended for background jobs like bulk loads or
+ * migrations that should run at a steady rate without overwhelming the cluster.
+ *
+ * Statements that are over the limit are queued and are admitted in submission order by a single
+ * dispatcher thread once enough tokens are available.  Asynchronous statements are executed by the
+ * dispatcher and the calling thread never blocks, synchronous statements block the calling thread until
+ * they reach the front of the queue and are admitted.
+ *
+ * Both limits can be adjusted at runtime from any thread.
+ *
+ * Shutdown is bounded: destroying the rate limited client cancels every statement still queued instead of
+ * sending it, see cancel().  Call drain() first to keep sending the queue at the configured limits for up to
+ * a timeout.
+ */
+class rate_limited_client
+{
+public:
+    /**
+     * @param client The client to execute statements through, it must outlive the rate_limited_client.
+     * @param requests_per_second The maximum number of statements per second, 0 is unlimited.
+     * @param bytes_per_second The maximum number of request bytes per second, 0 is unlimited.
+     */
+    rate_limited_client(client& client, double requests_per_second, double bytes_per_second = 0.0);
+
+    rate_limited_client(const rate_limited_client&) = delete;
+    rate_limited_client(rate_limited_client&&)      = delete;
+    auto operator=(const rate_limited_client&) -> rate_limited_client& = delete;
+    auto operator=(rate_limited_client &&) -> rate_limited_client& = delete;
+
+    /**
+     * Cancels every statement still queued, see cancel(), so every on_complete_callback is still called.
+     */
+    ~rate_limited_client();
+
+    /**
+     * @param rate The new maximum number of statements per second, 0 is unlimited.
+     * @param burst The number of statements that can execute back to back, 0 defaults to one second worth.
+     */
+    auto requests_per_second(double rate, double burst = 0.0) -> void;
+
+    /**
+     * @return The maximum number of statements per second, 0 is unlimited.
+     */
+    auto requests_per_second() const -> double;
+
+    /**
+     * @param rate The new maximum number of request bytes per second, 0 is unlimited.
+     * @param burst The number of bytes that can execute back to back, 0 defaults to one second worth.
+     */
+    auto bytes_per_second(double rate, double burst = 0.0) -> void;
+
+    /**
+     * @return The maximum number of request bytes per second, 0 is unlimited.
+     */
+    auto bytes_per_second() const -> double;
+
+    /**
+     * Executes the provided statement synchronously, blocking until every statement queued ahead of it
+     * has been admitted and the rate limits allow it to execute, and then until it completes or times out.
+     * @param statement The statement to execute.  Can be re-used via reset() after this call.
+     * @param timeout The timeout for this query.  0 signals no timeout.
+     * @param c The Cassandra consistency level to use for this query.
+     * @param request_bytes The number of bytes this statement counts against the bytes per second limit.
+     * @return The result of the query completion.
+     */
+    auto execute_statement(
+        const statement&          statement,
+        std::chrono::milliseconds timeout       = std::chrono::milliseconds{0},
+        consistency               c             = consistency::local_one,
+        size_t                    request_bytes = 0) -> priam::result;
+
+    /**
+     * Executes the provided statement asynchronously, this will return immediately.  If the rate limits
+     * do not allow the statement to execute now it is queued behind any other queued statements.
+     * See client::execute_statement() for details on the on_complete_callback.
+     * @param statement The statement to execute, ownership is moved in until it is executed.
+     * @param on_complete_callback The callback to execute with the result on the query completion.
+     * @param timeout The timeout for this query.  0 signals no timeout.
+     * @param c The Cassandra consistency level to use for this query.
+     * @param request_bytes The number of bytes this statement counts against the bytes per second limit.
+     */
+    auto execute_statement(
+        statement                          statement,
+        std::function<void(priam::result)> on_complete_callback,
+        std::chrono::milliseconds          timeout       = std::chrono::milliseconds{0},
+        consistency                        c             = consistency::local_one,
+        size_t                             request_bytes = 0) -> void;
+
+    /**
+     * @return The number of statements queued waiting on the rate limits.
+     */
+    auto queued() const -> size_t;
+
+    /**
+     * Blocks until every queued statement has been sent at the configured limits or the timeout expires.
+     * Statements submitted while draining are also waited on.
+     * @param timeout The longest time to wait.
+     * @return True if the queue is empty, statements already sent may still be executing.
+     */
+    auto drain(std::chrono::milliseconds timeout) -> bool;
+
+    /**
+     * Removes every queued statement without executing it.  Their on_complete_callbacks are called on this
+     * thread and blocked synchronous callers return, both with a result whose status is
+     * status::client_request_timed_out.
+     * @return The number of statements cancelled.
+     */
+    auto cancel() -> size_t;
+
+private:
+    /// A synchronous caller waiting on its turn, guarded by the mutex.
+    struct waiter
+    {
+        /// Set by the dispatcher once the caller may execute its statement.
+        bool m_admitted{false};
+        /// Set instead if the statement is cancelled before it is admitted.
+        bool m_cancelled{false};
+    };
+
+    struct queued_statement
+    {
+        /// The asynchronous statement, empty for a synchronous caller waiting on its turn.
+        std::optional<priam::statement>    m_statement;
+        std::function<void(priam::result)> m_on_complete_callback;
+        std::chrono::milliseconds          m_timeout;
+        consistency                        m_consistency;
+        size_t                             m_request_bytes;
+        /// The synchronous caller waiting on its turn, null for asynchronous statements.
+        waiter* m_waiter;
+    };
+
+    /// The client statements are executed through.
+    client& m_client;
+    /// Guards the token buckets and the queue.
+    mutable std::mutex m_mutex{};
+    /// Wakes the dispatcher when statements are queued, the limits change or on shutdown, and wakes
+    /// synchronous callers and drain() when statements leave the queue.
+    std::condition_variable m_cv{};
+    /// Statements per second limit.
+    token_bucket m_requests;
+    /// Request bytes per second limit.
+    token_bucket m_bytes;
+    /// Statements waiting on the limits in the order they were submitted.
+    std::deque<queued_statement> m_queue{};
+    /// Set on destruction to stop the dispatcher.
+    bool m_stop{false};
+    /// Executes queued statements as tokens become available.
+    std::thread m_dispatcher{};
+
+    /**
+     * Acquires tokens from both buckets or neither.  The mutex must be held.
+     * @param request_bytes The number of bytes to acquire from the bytes bucket.
+     * @return Zero if the tokens were acquired, otherwise the time to wait before trying again.
+     */
+    auto acquire(size_t request_bytes) -> std::chrono::nanoseconds;
+
+    /**
+     * The dispatcher thread's main loop.
+     */
+    auto dispatch() -> void;
+};
+
+} // namespace priam
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <chrono>
+
+namespace priam
+{
+/**
+ * A token bucket that refills at a constant rate up to a maximum burst size.  Each request acquires
+ * a number of tokens, e.g. one token per request or one token per byte, and is allowed once the bucket
+ * holds enough tokens.  A request larger than the burst size is allowed once the bucket is full and
+ * puts the bucket into debt so the long term rate is still respected.
+ *
+ * The token bucket is not thread safe, callers are expected to synchronize access.
+ */
+class token_bucket
+{
+public:
+    using clock = std::chrono::steady_clock;
+
+    /**
+     * @param rate The number of tokens refilled per second.  A rate of 0 disables the limit.
+     * @param burst The maximum number of tokens the bucket can hold.  0 defaults to one second worth of tokens.
+     */
+    explicit token_bucket(double rate = 0.0, double burst = 0.0);
+
+    token_bucket(const token_bucket&) = default;
+    token_bucket(token_bucket&&)      = default;
+    auto operator=(const token_bucket&) -> token_bucket& = default;
+    auto operator=(token_bucket &&) -> token_bucket& = default;
+
+    ~token_bucket() = default;
+
+    /**
+     * Changes the refill rate, tokens accrued at the previous rate up until now are kept.
+     * @param rate The number of tokens refilled per second.  A rate of 0 disables the limit.
+     * @param burst The maximum number of tokens the bucket can hold.  0 defaults to one second worth of tokens.
+     * @param now The current time.
+     */
+    auto rate(double rate, double burst = 0.0, clock::time_point now = clock::now()) -> void;
+
+    /**
+     * @return The number of tokens refilled per second, 0 means unlimited.
+     */
+    auto rate() const -> double { return m_rate; }
+
+    /**
+     * @return The maximum number of tokens the bucket can hold.
+     */
+    auto burst() const -> double { return m_burst; }
+
+    /**
+     * @return True if this bucket does not limit anything.
+     */
+    auto unlimited() const -> bool { return m_rate <= 0.0; }
+
+    /**
+     * @param tokens The number of tokens to check for.
+     * @param now The current time.
+     * @return The amount of time until 'tokens' can be acquired, zero if they can be acquired now.
+     */
+    auto wait_time(double tokens, clock::time_point now = clock::now()) -> std::chrono::nanoseconds;
+
+    /**
+     * @param tokens The number of tokens to acquire.
+     * @param now The current time.
+     * @return True if the tokens were acquired, false if the bucket does not have enough tokens yet.
+     */
+    auto try_acquire(double tokens, clock::time_point now = clock::now()) -> bool;
+
+private:
+    /// The number of tokens refilled per second.
+    double m_rate{0.0};
+    /// The maximum number of tokens the bucket can hold.
+    double m_burst{0.0};
+    /// The number of tokens currently available, this can go negative for requests larger than the burst.
+    double m_tokens{0.0};
+    /// The last time the bucket was refilled.
+    clock::time_point m_last_refill{clock::now()};
+
+    /**
+     * Adds the tokens accrued since the last refill.
+     * @param now The current time.
+     */
+    auto refill(clock::time_point now) -> void;
+};
+
+} // namespace priam
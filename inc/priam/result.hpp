@@ -1,14 +1,32 @@
 #pragma once
 
+#include "priam/byte_order.hpp"
+#include "priam/codec.hpp"
+#include "priam/column_view.hpp"
 #include "priam/cpp_driver.hpp"
+#include "priam/detached_result.hpp"
+#include "priam/mapping.hpp"
 #include "priam/row.hpp"
 #include "priam/status.hpp"
 
+#include <algorithm>
+#include <array>
 #include <chrono>
+#include <condition_variable>
+#include <exception>
 #include <functional>
 #include <iterator>
 #include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
 #include <string>
+#include <string_view>
+#include <thread>
+#include <tuple>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 #include <iostream>
@@ -16,29 +34,45 @@
 namespace priam
 {
 class client;
+class arrow_exporter;
+class rate_limited_client;
 
 class result
 {
     /// Client is a friend to call a result's private constructor.
     friend client;
+    /// Typed prepared statements decode directly from the underlying result.
+    template<typename, typename>
+    friend class typed_prepared;
+    /// Arrow exports decode directly from the underlying result.
+    friend arrow_exporter;
+    /// Rate limited clients fail statements they cancel before executing them.
+    friend rate_limited_client;
 
 public:
+    /**
+     * A single pass input iterator, it satisfies std::input_iterator so results compose with C++20 range
+     * adaptors, e.g. std::views::filter and std::views::transform, lazily in one pass over the driver's iterator.
+     * Dereferencing returns a new priam::row for the current row.
+     */
     class iterator
     {
     public:
+        using iterator_concept  = std::input_iterator_tag;
         using iterator_category = std::input_iterator_tag;
         using value_type        = priam::row;
         using difference_type   = std::ptrdiff_t;
-        using pointer           = const priam::row*;
-        using reference         = const priam::row&;
+        using pointer           = void;
+        using reference         = priam::row;
 
+        iterator() = default;
         iterator(cass_iterator_ptr iter_ptr, const CassRow* cass_row)
             : m_iter_ptr(std::move(iter_ptr)),
               m_cass_row(cass_row)
         {
         }
         iterator(const iterator&) = delete;
-        iterator(iterator&& other)
+        iterator(iterator&& other) noexcept
             : m_iter_ptr(std::move(other.m_iter_ptr)),
               m_cass_row(std::exchange(other.m_cass_row, nullptr))
         {
@@ -62,18 +96,26 @@ public:
             return *this;
         }
 
-        auto operator++(int) -> iterator
-        {
-            advance();
-            return iterator{std::move(m_iter_ptr), std::exchange(m_cass_row, nullptr)};
-        }
+        /**
+         * Post increment of a single pass iterator, there is nothing to return since the driver invalidates the
+         * previous row.
+         */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Weffc++"
+        auto operator++(int) -> void { advance(); }
+#pragma GCC diagnostic pop
 
-        auto operator*() -> priam::row { return priam::row{m_cass_row}; }
+        auto operator*() const -> priam::row { return priam::row{m_cass_row}; }
 
         auto operator==(const iterator& other) const -> bool { return m_cass_row == other.m_cass_row; }
 
         auto operator!=(const iterator& other) const -> bool { return !(*this == other); }
 
+        friend auto operator==(const iterator& it, end_sentinel) -> bool { return it.m_cass_row == nullptr; }
+        friend auto operator==(end_sentinel, const iterator& it) -> bool { return it.m_cass_row == nullptr; }
+        friend auto operator!=(const iterator& it, end_sentinel) -> bool { return it.m_cass_row != nullptr; }
+        friend auto operator!=(end_sentinel, const iterator& it) -> bool { return it.m_cass_row != nullptr; }
+
     private:
         /// The iterator must maintain the lifetime of the cassandra driver's iterator.
         cass_iterator_ptr m_iter_ptr{nullptr};
@@ -100,7 +142,7 @@ public:
     };
 
     auto begin() const -> iterator;
-    auto end() const -> iterator;
+    auto end() const -> end_sentinel { return end_sentinel{}; }
 
     result(const result&) = delete;
     result(result&&)      = default;
@@ -169,6 +211,187 @@ public:
         }
     }
 
+    /**
+     * Splits the rows into 'task_count' contiguous ranges and submits one task per range to 'executor'.  The
+     * driver only iterates forward, so the rows are decoded once in a single pass into the row_at() index and
+     * the tasks read their ranges from it.  This blocks until every task has completed.  The functor takes a
+     * single parameter `const priam::detached_row&` and is called concurrently.
+     * @tparam executor_type Called with each task, a `void()` callable, e.g. a thread pool's submit.  Tasks
+     *                       may also be run inline.
+     * @param executor Runs the tasks.
+     * @param row_callback Called with every row.
+     * @param task_count The number of tasks, at most one per row.
+     * @throws The first exception thrown by 'row_callback' or 'executor', once every submitted task has completed.
+     */
+    template<typename executor_type, typename functor_type>
+    auto parallel_for_each(
+        executor_type&& executor, functor_type&& row_callback, size_t task_count = default_task_count()) const
+        -> void
+    {
+        if (m_row_index == nullptr)
+        {
+            return;
+        }
+
+        const auto& rows  = indexed_rows();
+        auto        count = rows.row_count();
+        if (count == 0)
+        {
+            return;
+        }
+
+        task_count = std::clamp<size_t>(task_count, 1, count);
+        task_latch latch{task_count};
+        for (size_t task = 0; task < task_count; ++task)
+        {
+            auto first = count * task / task_count;
+            auto last  = count * (task + 1) / task_count;
+            try
+            {
+                executor([&rows, &latch, &row_callback, first, last]() {
+                    try
+                    {
+                        for (auto i = first; i < last; ++i)
+                        {
+                            const detached_row row = rows.row_at(i);
+                            row_callback(row);
+                        }
+                    }
+                    catch (...)
+                    {
+                        latch.fail(std::current_exception());
+                    }
+                    latch.count_down();
+                });
+            }
+            catch (...)
+            {
+                latch.fail(std::current_exception());
+                latch.count_down();
+            }
+        }
+        latch.wait();
+    }
+
+    /**
+     * Random access to the rows.  The driver only iterates forward and invalidates the rows it has moved past,
+     * so the first call copies every row once into a detached_result index, see detach(), later calls are
+     * O(1).  This is safe to call concurrently.
+     * @param index The row index, must be less than row_count().
+     * @return The row at 'index', it is valid for the lifetime of this result.
+     */
+    auto row_at(size_t index) const -> detached_row;
+
+    /**
+     * The column names and types are resolved once when the result is created.  Nullability is not
+     * part of the driver's result metadata, check value::is_null() on each value instead.
+     * @return The columns of each row in column order.
+     */
+    auto columns() const -> const std::vector<column_handle>& { return m_columns; }
+
+    /**
+     * Resolves a column once so every row can look it up with a direct index, see row::column(column_handle).
+     * @param name The column name.
+     * @throws std::runtime_error If the result has no column named 'name'.
+     * @return The column's handle, only valid for rows of this result.
+     */
+    auto column(std::string_view name) const -> const column_handle&;
+
+    /**
+     * @param name The column name.
+     * @return The index of the column, or std::nullopt if the result has no column named 'name'.
+     */
+    auto column_index(std::string_view name) const -> std::optional<size_t>;
+
+    /**
+     * Decodes every row into a struct described by priam::mapping<value_type>.  The column of each mapped
+     * member is resolved and its type checked once, then every row is decoded straight into a reserved
+     * vector.  Members decoded as views, e.g. std::string_view, borrow from this result.
+     * @tparam value_type The struct to decode each row into.
+     * @throws std::runtime_error If a mapped column is missing or its type does not match the member type.
+     * @return The decoded rows.
+     */
+    template<typename value_type>
+    auto as() const -> std::vector<value_type>
+    {
+        constexpr const auto& fields      = mapping<value_type>::fields;
+        constexpr size_t      field_count = std::tuple_size_v<std::decay_t<decltype(fields)>>;
+
+        std::vector<value_type> output{};
+        if (m_cass_result_ptr == nullptr)
+        {
+            return output;
+        }
+
+        std::array<size_t, field_count> columns{};
+        resolve_fields(fields, columns, std::make_index_sequence<field_count>{});
+
+        output.reserve(row_count());
+        cass_iterator_ptr cass_iterator_ptr{cass_iterator_from_result(m_cass_result_ptr.get())};
+        while (cass_iterator_next(cass_iterator_ptr.get()))
+        {
+            const CassRow* cass_row = cass_iterator_get_row(cass_iterator_ptr.get());
+            auto&          row      = output.emplace_back();
+            decode_fields(fields, columns, cass_row, row, std::make_index_sequence<field_count>{});
+        }
+        return output;
+    }
+
+    /**
+     * Decodes a single column of every row into a contiguous array and a validity bitmap.  Fixed width columns
+     * are copied as they arrive from the server and then converted from network byte order in bulk with SIMD,
+     * text columns are dictionary encoded and their dictionary borrows from this result.
+     * @tparam value_type bool, int8_t, int16_t, int32_t, int64_t, uint32_t (date), float, double or
+     *                    std::string_view (ascii/text/varchar).
+     * @param column The column to decode, see column().
+     * @throws std::runtime_error If the column's type does not match value_type.
+     * @return The decoded column.
+     */
+    template<typename value_type>
+    auto column_view(const column_handle& column) const -> priam::column_view<value_type>
+    {
+        static_assert(
+            std::is_arithmetic_v<value_type> || std::is_same_v<value_type, std::string_view>,
+            "priam::result::column_view only decodes fixed width and text columns.");
+
+        check_column(column, &codec<value_type>::accepts);
+
+        priam::column_view<value_type> view{};
+        if constexpr (std::is_same_v<value_type, std::string_view>)
+        {
+            decode_dictionary(column, view);
+        }
+        else
+        {
+            view.m_values.resize(row_count());
+            decode_fixed(column, sizeof(value_type), reinterpret_cast<uint8_t*>(view.m_values.data()), view);
+            if constexpr (sizeof(value_type) > 1)
+            {
+                big_endian_to_host(view.m_values.data(), view.m_values.size());
+            }
+        }
+        return view;
+    }
+
+    /**
+     * @param name The column name.
+     * @throws std::runtime_error If the column does not exist or its type does not match value_type.
+     * @return The decoded column, see column_view(const column_handle&).
+     */
+    template<typename value_type>
+    auto column_view(std::string_view name) const -> priam::column_view<value_type>
+    {
+        return column_view<value_type>(column(name));
+    }
+
+    /**
+     * Copies every row into a single block allocated from 'memory_resource' and releases the driver's buffers.
+     * Only status() is usable on this result afterwards, read the rows from the detached result.
+     * @param memory_resource The resource to allocate the detached result's block from.
+     * @return The detached result, it outlives this result and the client.
+     */
+    auto detach(std::pmr::memory_resource* memory_resource = std::pmr::get_default_resource()) -> detached_result;
+
 private:
     /// The underlying query future.
     cass_future_ptr m_cass_future_ptr{nullptr};
@@ -176,12 +399,124 @@ private:
     cass_result_ptr m_cass_result_ptr{nullptr};
     /// The query future status.
     priam::status m_status{status::ok};
+    /// The name and type of each column, resolved once from the result metadata.
+    std::vector<column_handle> m_columns{};
+
+    /// The lazily built copy of every row for random access, see row_at().
+    struct row_index
+    {
+        std::once_flag  m_built{};
+        detached_result m_rows{};
+    };
+    /// Allocated with the result so row_at() only needs to synchronize building it.
+    std::unique_ptr<row_index> m_row_index{nullptr};
+
+    /**
+     * Builds the row index on the first call, this is safe to call concurrently.
+     * @return Every row copied into a detached result.
+     */
+    auto indexed_rows() const -> const detached_result&;
+
+    /**
+     * Counts down the tasks of a parallel_for_each() and keeps the first exception thrown by any of them.
+     */
+    class task_latch
+    {
+    public:
+        explicit task_latch(size_t count) : m_remaining(count) {}
+
+        auto fail(std::exception_ptr error) -> void;
+        auto count_down() -> void;
+
+        /**
+         * Blocks until every task has counted down.
+         * @throws The first exception passed to fail().
+         */
+        auto wait() -> void;
+
+    private:
+        std::mutex              m_mutex{};
+        std::condition_variable m_done{};
+        size_t                  m_remaining{0};
+        std::exception_ptr      m_error{nullptr};
+    };
+
+    /**
+     * @return The hardware concurrency, at least 1.
+     */
+    static auto default_task_count() -> size_t { return std::max<size_t>(std::thread::hardware_concurrency(), 1); }
 
     /**
      * @param query_future The underlying cassandra query future.  The result takes ownership and will
      *                     delete the query_future upon destruction.
      */
     explicit result(CassFuture* query_future);
+
+    /**
+     * Creates the result of a statement that was never executed, only status() is usable.
+     * @param status The reason the statement was not executed.
+     */
+    explicit result(priam::status status) : m_status(status) {}
+
+    /**
+     * @param column The column to check.
+     * @param accepts The C++ type's codec type check.
+     * @throws std::runtime_error If the column's type is not accepted.
+     */
+    auto check_column(const column_handle& column, bool (*accepts)(const CassDataType*)) const -> void;
+
+    /**
+     * Copies the raw network order bytes of every row's value in 'column' into 'values' and fills in the
+     * validity, null values are left zeroed.
+     * @param column The column to decode.
+     * @param width The width of each value in bytes.
+     * @param values The output array, must hold row_count() values.
+     * @param validity The output validity.
+     */
+    auto decode_fixed(const column_handle& column, size_t width, uint8_t* values, column_validity& validity) const
+        -> void;
+
+    /**
+     * Dictionary encodes every row's text value in 'column'.
+     * @param column The column to decode.
+     * @param view The output column.
+     */
+    auto decode_dictionary(const column_handle& column, priam::column_view<std::string_view>& view) const -> void;
+
+    /**
+     * @param name The column name of a mapped field.
+     * @param accepts The field's codec type check.
+     * @throws std::runtime_error If the column is missing or its type is not accepted.
+     * @return The column index of the field.
+     */
+    auto resolve_field(std::string_view name, bool (*accepts)(const CassDataType*)) const -> size_t;
+
+    template<typename fields_type, size_t field_count, size_t... indexes>
+    auto resolve_fields(
+        const fields_type& fields, std::array<size_t, field_count>& columns, std::index_sequence<indexes...>) const
+        -> void
+    {
+        using std::get;
+        ((columns[indexes] = resolve_field(
+              get<indexes>(fields).name,
+              &codec<typename std::tuple_element_t<indexes, fields_type>::value_type>::accepts)),
+         ...);
+    }
+
+    template<typename fields_type, size_t field_count, typename value_type, size_t... indexes>
+    static auto decode_fields(
+        const fields_type&                     fields,
+        const std::array<size_t, field_count>& columns,
+        const CassRow*                         cass_row,
+        value_type&                            row,
+        std::index_sequence<indexes...>) -> void
+    {
+        using std::get;
+        ((row.*(get<indexes>(fields).member) =
+              codec<typename std::tuple_element_t<indexes, fields_type>::value_type>::decode(
+                  cass_row_get_column(cass_row, columns[indexes]))),
+         ...);
+    }
 };
 
 } // namespace priam
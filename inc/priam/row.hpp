@@ -1,34 +1,100 @@
 #pragma once
 
 #include "priam/cpp_driver.hpp"
+#include "priam/type.hpp"
 #include "priam/value.hpp"
 
+#include <cstddef>
+#include <iterator>
+#include <string_view>
+#include <utility>
+
 namespace priam
 {
 class result;
 
+/**
+ * A column of a result resolved once, see result::column().  Looking up a column by handle in a row is a
+ * direct index and the values it returns already know their data type.  A handle borrows from the result
+ * it was resolved from and is only valid for rows of that result.
+ */
+class column_handle
+{
+    /// Only results resolve column handles.
+    friend result;
+
+public:
+    /**
+     * @return The index of the column in each row.
+     */
+    auto index() const -> size_t { return m_index; }
+
+    /**
+     * @return The name of the column.
+     */
+    auto name() const -> std::string_view { return m_name; }
+
+    /**
+     * @return The data type of the column.
+     */
+    auto type() const -> data_type { return m_type; }
+
+private:
+    /// The index of the column in each row.
+    size_t m_index{0};
+    /// The name of the column, borrowed from the result.
+    std::string_view m_name{};
+    /// The data type of the column.
+    data_type m_type{data_type::unknown};
+    /// The driver's data type of the column, borrowed from the result.
+    const CassDataType* m_cass_data_type{nullptr};
+
+    column_handle(size_t index, std::string_view name, const CassDataType* cass_data_type)
+        : m_index(index),
+          m_name(name),
+          m_type(to_data_type(cass_data_type)),
+          m_cass_data_type(cass_data_type)
+    {
+    }
+};
+
+/**
+ * The end of a result's rows or a row's values, see result::end() and row::end().  It is a separate type from
+ * the single pass iterators so that they model std::sentinel_for.
+ */
+struct end_sentinel
+{
+};
+
 class row
 {
     /// For private constructor, only result's can create rows.
     friend result;
 
 public:
+    /**
+     * A single pass input iterator, it satisfies std::input_iterator so rows compose with C++20 range
+     * adaptors, e.g. std::views::filter and std::views::transform, lazily in one pass over the driver's iterator.
+     * Dereferencing returns a new priam::value for the current column.
+     */
     class iterator
     {
     public:
+        using iterator_concept  = std::input_iterator_tag;
         using iterator_category = std::input_iterator_tag;
         using value_type        = priam::value;
         using difference_type   = std::ptrdiff_t;
-        using pointer           = const priam::value*;
-        using reference         = const priam::value&;
+        using pointer           = void;
+        using reference         = priam::value;
 
+        iterator() = default;
         iterator(cass_iterator_ptr iter_ptr, const CassValue* cass_value)
             : m_iter_ptr(std::move(iter_ptr)),
               m_cass_value(cass_value)
         {
         }
         iterator(const iterator&) = delete;
-        iterator(iterator&& other)
+        iterator(iterator&& other) noexcept
             : m_iter_ptr(std::move(other.m_iter_ptr)),
               m_cass_value(std::exchange(other.m_cass_value, nullptr))
         {
@@ -51,18 +117,26 @@ public:
             return *this;
         }
 
-        auto operator++(int) -> iterator
-        {
-            advance();
-            return iterator{std::move(m_iter_ptr), std::exchange(m_cass_value, nullptr)};
-        }
+        /**
+         * Post increment of a single pass iterator, there is nothing to return since the driver invalidates the
+         * previous value.
+         */
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Weffc++"
+        auto operator++(int) -> void { advance(); }
+#pragma GCC diagnostic pop
 
-        auto operator*() -> priam::value { return priam::value{m_cass_value}; }
+        auto operator*() const -> priam::value { return priam::value{m_cass_value}; }
 
         auto operator==(const iterator& other) const -> bool { return m_cass_value == other.m_cass_value; }
 
         auto operator!=(const iterator& other) const -> bool { return !(*this == other); }
 
+        friend auto operator==(const iterator& it, end_sentinel) -> bool { return it.m_cass_value == nullptr; }
+        friend auto operator==(end_sentinel, const iterator& it) -> bool { return it.m_cass_value == nullptr; }
+        friend auto operator!=(const iterator& it, end_sentinel) -> bool { return it.m_cass_value != nullptr; }
+        friend auto operator!=(end_sentinel, const iterator& it) -> bool { return it.m_cass_value != nullptr; }
+
     private:
         /// The iterator must maintain the lifetime of the cassandra driver's iterator.
         cass_iterator_ptr m_iter_ptr{nullptr};
@@ -89,7 +163,7 @@ public:
     };
 
     auto begin() const -> iterator;
-    auto end() const -> iterator;
+    auto end() const -> end_sentinel { return end_sentinel{}; }
 
     row(const row&) = delete;
     row(row&&)      = delete;
@@ -97,6 +171,8 @@ public:
     auto operator=(row &&) -> row& = delete;
 
     /**
+     * Looks the column up by name on every call, when reading many rows resolve a column_handle once
+     * with result::column() instead.
      * @param name The column's name to fetch.
      * @throws std::runtime_error If the column does not exist.
      * @return The column's value.
@@ -124,6 +200,21 @@ public:
      */
     auto operator[](size_t column_idx) const -> value;
 
+    /**
+     * @param column The column resolved from this row's result, see result::column().
+     * @return The column's value, its type is already known.
+     */
+    auto column(const column_handle& column) const -> value
+    {
+        return value{cass_row_get_column(m_cass_row, column.index()), column.type()};
+    }
+
+    /**
+     * @param column The column resolved from this row's result, see result::column().
+     * @return The column's value, its type is already known.
+     */
+    auto operator[](const column_handle& column) const -> value { return this->column(column); }
+
     /**
      * Iterate over each column's value in the row.  The functor takes a single parameter `const priam::value&`.
      * @param value_callback Callback function to be called on each column value.
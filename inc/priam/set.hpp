@@ -1,5 +1,6 @@
 #pragma once
 
+#include "priam/collection.hpp"
 #include "priam/cpp_driver.hpp"
 #include "priam/value.hpp"
 
@@ -39,4 +40,17 @@ private:
     explicit set(const CassValue* cass_value);
 };
 
+/**
+ * The elements of a Cassandra 'set' to bind to a statement, see statement::bind_set().  Cassandra removes
+ * duplicate elements.
+ */
+class statement_set : public statement_collection
+{
+public:
+    /**
+     * @param reserve_size The approximate number of items in the collection.
+     */
+    explicit statement_set(size_t reserve_size);
+};
+
 } // namespace priam
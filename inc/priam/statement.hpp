@@ -1,12 +1,23 @@
 #pragma once
 
 #include "priam/blob.hpp"
+#include "priam/codec.hpp"
 #include "priam/cpp_driver.hpp"
 #include "priam/list.hpp"
+#include "priam/map.hpp"
+#include "priam/set.hpp"
+#include "priam/statement_pool.hpp"
 #include "priam/status.hpp"
+#include "priam/tuple.hpp"
+#include "priam/user_type.hpp"
 
+#include <atomic>
+#include <iterator>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <type_traits>
+#include <utility>
 #include <vector>
 
 namespace priam
@@ -24,18 +35,22 @@ class statement
 
 public:
     /**
-     * Creates an ad-hoc statement to be executed.  Use '?' placeholders for locations to bind
-     * parameters to.
+     * Creates an ad-hoc statement to be executed.  Use '?' or ':name' placeholders for locations to bind
+     * parameters to, placeholders inside string literals, quoted identifiers and comments are ignored.
      * @param query The cql query to be executed.
      */
     explicit statement(std::string_view query);
 
     statement(const statement&) = delete;
-    statement(statement&&)      = default;
+    statement(statement&& other);
     auto operator=(const statement&) -> statement& = delete;
-    auto operator=(statement &&) -> statement& = default;
+    auto operator=(statement&& other) -> statement&;
 
-    ~statement() = default;
+    /**
+     * Statements acquired from a prepared statement's pool are reset and returned to the pool, unless a request
+     * executing them may still be in flight.
+     */
+    ~statement();
 
     /**
      * @param position The bind position.
@@ -191,6 +206,62 @@ public:
      */
     auto bind_list(statement_list list, std::string_view name) -> status;
 
+    /**
+     * @param set Bind this set to the prepared statement.
+     * @param position The bind position.
+     * @return CASS_OK on success.
+     */
+    auto bind_set(statement_set set, size_t position) -> status;
+
+    /**
+     * @param set Bind this set to the prepared statement.
+     * @param name Parameter name to bind the set to.
+     * @return CASS_OK on success.
+     */
+    auto bind_set(statement_set set, std::string_view name) -> status;
+
+    /**
+     * @param map Bind this map to the prepared statement.
+     * @param position The bind position.
+     * @return CASS_OK on success.
+     */
+    auto bind_map(statement_map map, size_t position) -> status;
+
+    /**
+     * @param map Bind this map to the prepared statement.
+     * @param name Parameter name to bind the map to.
+     * @return CASS_OK on success.
+     */
+    auto bind_map(statement_map map, std::string_view name) -> status;
+
+    /**
+     * @param tuple Bind this tuple to the prepared statement.
+     * @param position The bind position.
+     * @return CASS_OK on success.
+     */
+    auto bind_tuple(statement_tuple tuple, size_t position) -> status;
+
+    /**
+     * @param tuple Bind this tuple to the prepared statement.
+     * @param name Parameter name to bind the tuple to.
+     * @return CASS_OK on success.
+     */
+    auto bind_tuple(statement_tuple tuple, std::string_view name) -> status;
+
+    /**
+     * @param user_type Bind this user defined type to the prepared statement.
+     * @param position The bind position.
+     * @return CASS_OK on success.
+     */
+    auto bind_user_type(statement_user_type user_type, size_t position) -> status;
+
+    /**
+     * @param user_type Bind this user defined type to the prepared statement.
+     * @param name Parameter name to bind the user defined type to.
+     * @return CASS_OK on success.
+     */
+    auto bind_user_type(statement_user_type user_type, std::string_view name) -> status;
+
     /**
      * @param blob Bind this blob to the prepared statement.
      * @param position The bind position.
@@ -205,11 +276,126 @@ public:
      */
     auto bind_blob(blob blob, std::string_view name) -> status;
 
+    /**
+     * @param value Bind this arbitrary precision integer to the prepared statement.
+     * @param position The bind position.
+     * @return CASS_OK on success.
+     */
+    auto bind_varint(const varint& value, size_t position) -> status;
+
+    /**
+     * @param value Bind this arbitrary precision integer to the prepared statement.
+     * @param name Parameter name to bind the varint to.
+     * @return CASS_OK on success.
+     */
+    auto bind_varint(const varint& value, std::string_view name) -> status;
+
+    /**
+     * @param value Bind this decimal to the prepared statement.
+     * @param position The bind position.
+     * @return CASS_OK on success.
+     */
+    auto bind_decimal(const decimal& value, size_t position) -> status;
+
+    /**
+     * @param value Bind this decimal to the prepared statement.
+     * @param name Parameter name to bind the decimal to.
+     * @return CASS_OK on success.
+     */
+    auto bind_decimal(const decimal& value, std::string_view name) -> status;
+
+    /**
+     * Binds a Cassandra 5 'vector<float, N>' column.  The elements are byte swapped to big endian with SIMD
+     * instructions into a buffer each thread reuses, so binding does not allocate once the buffer has grown.
+     * @param values The vector's elements.
+     * @param count The number of elements, it must match the column's dimension.
+     * @param position The bind position.
+     * @return CASS_OK on success.
+     */
+    auto bind_vector(const float* values, size_t count, size_t position) -> status;
+
+    /**
+     * Binds a Cassandra 5 'vector<float, N>' column, see bind_vector(const float*, size_t, size_t).
+     */
+    auto bind_vector(const float* values, size_t count, std::string_view name) -> status;
+
+    /**
+     * Binds a Cassandra 5 'vector<double, N>' column, see bind_vector(const float*, size_t, size_t).
+     */
+    auto bind_vector(const double* values, size_t count, size_t position) -> status;
+
+    /**
+     * Binds a Cassandra 5 'vector<double, N>' column, see bind_vector(const float*, size_t, size_t).
+     */
+    auto bind_vector(const double* values, size_t count, std::string_view name) -> status;
+
+    /**
+     * @param values A contiguous container of floats or doubles, e.g. std::array<float, 768>.
+     * @param position The bind position.
+     * @return CASS_OK on success.
+     */
+    template<typename container_type>
+    auto bind_vector(const container_type& values, size_t position) -> status
+    {
+        return bind_vector(std::data(values), std::size(values), position);
+    }
+
+    /**
+     * @param values A contiguous container of floats or doubles, e.g. std::array<float, 768>.
+     * @param name Parameter name to bind the vector to.
+     * @return CASS_OK on success.
+     */
+    template<typename container_type>
+    auto bind_vector(const container_type& values, std::string_view name) -> status
+    {
+        return bind_vector(std::data(values), std::size(values), name);
+    }
+
+    /**
+     * Binds a value using the driver bind function for its C++ type, chosen at compile time, see priam::codec.
+     * @tparam value_type The C++ type of the value, a priam::codec specialization must exist for it.
+     * @param value The value to bind, an empty std::optional binds null.
+     * @param position The bind position.
+     * @return status::ok on success.
+     */
+    template<typename value_type>
+    auto bind(const value_type& value, size_t position) -> status
+    {
+        return static_cast<status>(
+            codec<std::decay_t<value_type>>::bind(m_cass_statement_ptr.get(), position, value));
+    }
+
+    /**
+     * Binds every argument in order starting at position 0, see bind().  Binding stops at the
+     * first failure.
+     * @param args The values to bind, one per parameter.
+     * @return status::ok if every value was bound, otherwise the status of the first failure.
+     */
+    template<typename... args_type>
+    auto bind_all(const args_type&... args) -> status
+    {
+        status rc{status::ok};
+        size_t position{0};
+        (void)(((rc = bind(args, position++)) == status::ok) && ...);
+        return rc;
+    }
+
     /**
      * Resets all bound parameters on the statement for another execution.
      */
     auto reset() -> status;
 
+    /**
+     * @return The number of parameters that can be bound to this statement.
+     */
+    auto parameter_count() const -> size_t { return m_parameter_count; }
+
+    /**
+     * @return The query text of an ad-hoc statement created while auto prepare is enabled on any client,
+     *         otherwise empty.
+     */
+    auto query() const -> std::string_view { return (m_query != nullptr) ? *m_query : std::string_view{}; }
+
 private:
     /**
      * Creates a Prepared statement object from the provided underlying cassandra prepared object.
@@ -219,10 +405,29 @@ private:
      */
     explicit statement(const CassPrepared* cass_prepared, size_t parameter_count);
 
+    /**
+     * Acquires a statement from the pool, it is returned to the pool when this statement is destroyed.
+     * @param pool The prepared statement's pool.
+     */
+    explicit statement(std::shared_ptr<statement_pool> pool);
+
+    /// The interned query text used to find the statement in the client's auto prepare cache, only kept while
+    /// auto prepare is enabled, see auto_prepare_cache::intern().
+    std::shared_ptr<const std::string> m_query{nullptr};
     /// The number of parameters that can be bound to this statement.
     size_t m_parameter_count{0};
     /// The underlying cassandra prepared statement object.
     cass_statement_ptr m_cass_statement_ptr{nullptr};
+    /// The pool to return the underlying statement to, nullptr if it is not pooled.
+    std::shared_ptr<statement_pool> m_pool{nullptr};
+    /// Cleared by the client when the driver may still be sending the statement after the call that executed it
+    /// returned, e.g. a timed out synchronous request, the statement is then freed rather than pooled.
+    mutable std::atomic<bool> m_recyclable{true};
+
+    /**
+     * Returns the underlying statement to the pool if it is pooled and no request may still be using it.
+     */
+    auto release_to_pool() -> void;
 };
 
 } // namespace priam
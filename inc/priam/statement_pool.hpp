@@ -0,0 +1,77 @@
+#pragma once
+
+#include "priam/cpp_driver.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+namespace priam
+{
+/**
+ * A pool of reusable statements bound to a single prepared statement, see prepared::acquire_statement().
+ * The pool is a fixed array of slots that are claimed and filled with atomic exchanges, so it is
+ * lock-free and free of ABA problems.  Each thread starts scanning at its own slot so threads
+ * tend to reuse the statements they returned without contending with each other.  When the pool
+ * is empty a new statement is bound and when it is full a returned statement is freed.
+ */
+class statement_pool
+{
+public:
+    /// The default number of statements a pool retains.
+    static constexpr size_t default_capacity = 64;
+
+    /**
+     * @param cass_prepared The prepared statement to bind pooled statements from.  The pool does not own it,
+     *                      every pooled statement retains its own reference.
+     * @param parameter_count The number of parameters to reset on returned statements.
+     * @param capacity The maximum number of idle statements to retain.
+     */
+    statement_pool(const CassPrepared* cass_prepared, size_t parameter_count, size_t capacity = default_capacity);
+
+    statement_pool(const statement_pool&) = delete;
+    statement_pool(statement_pool&&)      = delete;
+    auto operator=(const statement_pool&) -> statement_pool& = delete;
+    auto operator=(statement_pool &&) -> statement_pool& = delete;
+
+    ~statement_pool();
+
+    /**
+     * @return An idle statement with no parameters bound, or a newly bound statement if the pool is empty.
+     */
+    auto acquire() -> cass_statement_ptr;
+
+    /**
+     * Resets the bound parameters and request timeout of the statement and returns it to the pool.
+     * @param cass_statement A statement previously acquired from this pool.
+     */
+    auto release(cass_statement_ptr cass_statement) -> void;
+
+    /**
+     * @return The parameter count of the pooled statements.
+     */
+    auto parameter_count() const -> size_t { return m_parameter_count; }
+
+    /**
+     * @return The number of idle statements in the pool, this is a snapshot while other threads are
+     *         acquiring and releasing statements.
+     */
+    auto size() const -> size_t;
+
+private:
+    /// The prepared statement pooled statements are bound from.
+    const CassPrepared* m_cass_prepared{nullptr};
+    /// The number of parameters on each pooled statement.
+    size_t m_parameter_count{0};
+    /// The number of slots.
+    size_t m_capacity{0};
+    /// Idle statements, nullptr for an empty slot.
+    std::unique_ptr<std::atomic<CassStatement*>[]> m_slots{nullptr};
+
+    /**
+     * @return The slot the calling thread starts scanning from.
+     */
+    auto start_slot() const -> size_t;
+};
+
+} // namespace priam
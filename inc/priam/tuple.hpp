@@ -1,5 +1,7 @@
 #pragma once
 
+#include "priam/codec.hpp"
+#include "priam/collection.hpp"
 #include "priam/cpp_driver.hpp"
 #include "priam/value.hpp"
 
@@ -39,4 +41,52 @@ private:
     explicit tuple(const CassValue* cass_value);
 };
 
+/**
+ * The elements of a Cassandra 'tuple' to bind to a statement, see statement::bind_tuple().  Elements are set
+ * in order as they are appended.
+ */
+class statement_tuple
+{
+    friend statement;
+    friend statement_collection;
+
+public:
+    /**
+     * @param item_count The number of elements in the tuple.
+     */
+    explicit statement_tuple(size_t item_count);
+    statement_tuple(const statement_tuple&) = delete;
+    statement_tuple(statement_tuple&&)      = default;
+    auto operator=(const statement_tuple&) -> statement_tuple& = delete;
+    auto operator=(statement_tuple&&) -> statement_tuple& = default;
+    ~statement_tuple()                                    = default;
+
+    /**
+     * Sets the next element using the driver function for its C++ type, see priam::codec.
+     * @param value The element, an empty std::optional sets null.
+     * @return True if the element was set, the next append sets the element after it.
+     */
+    template<typename value_type>
+    auto append(const value_type& value) -> bool
+    {
+        if (codec<std::decay_t<value_type>>::set(m_cass_tuple_ptr.get(), m_index, value) != CASS_OK)
+        {
+            return false;
+        }
+        ++m_index;
+        return true;
+    }
+
+    /**
+     * Sets the next element to null.
+     * @return True if the element was set.
+     */
+    auto append_null() -> bool;
+
+private:
+    cass_tuple_ptr m_cass_tuple_ptr{nullptr};
+    /// The index of the next element to set.
+    size_t m_index{0};
+};
+
 } // namespace priam
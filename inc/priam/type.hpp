@@ -49,4 +49,14 @@ enum class data_type : int64_t
  */
 auto to_string(data_type type) -> const std::string&;
 
+/**
+ * @param cass_data_type The driver's data type, can be nullptr.
+ * @return The data type, or data_type::unknown if 'cass_data_type' is nullptr.
+ */
+inline auto to_data_type(const CassDataType* cass_data_type) -> data_type
+{
+    return (cass_data_type != nullptr) ? static_cast<data_type>(cass_data_type_type(cass_data_type))
+                                       : data_type::unknown;
+}
+
 } // namespace priam
@@ -0,0 +1,166 @@
+#pragma once
+
+#include "priam/codec.hpp"
+#include "priam/prepared.hpp"
+#include "priam/result.hpp"
+#include "priam/statement.hpp"
+#include "priam/status.hpp"
+
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <utility>
+#include <vector>
+
+namespace priam
+{
+/**
+ * A prepared statement with compile time parameter and result column types, see
+ * client::prepared_register<params_type, columns_type>().  The parameter types are checked against the
+ * prepared statement's metadata once when it is registered.  The cpp-driver does not expose result
+ * metadata for prepared statements, so the column types are checked once per result instead of once per
+ * value.  Binding and decoding then map straight onto the driver functions for each type through
+ * priam::codec without any runtime type checks.
+ *
+ * @tparam params_type std::tuple of the C++ parameter types, in bind position order.
+ * @tparam columns_type std::tuple of the C++ result column types, in column order.
+ */
+template<typename params_type, typename columns_type = std::tuple<>>
+class typed_prepared;
+
+template<typename... params_type, typename... columns_type>
+class typed_prepared<std::tuple<params_type...>, std::tuple<columns_type...>>
+{
+public:
+    /// A decoded row.
+    using row_type = std::tuple<columns_type...>;
+
+    /**
+     * @param prepared_ptr The prepared statement to type.
+     * @throws std::runtime_error If the parameter count or any parameter type does not match params_type.
+     */
+    explicit typed_prepared(std::shared_ptr<priam::prepared> prepared_ptr) : m_prepared_ptr(std::move(prepared_ptr))
+    {
+        if (m_prepared_ptr->parameter_count() != sizeof...(params_type))
+        {
+            throw std::runtime_error(
+                "priam::typed_prepared: expected " + std::to_string(sizeof...(params_type)) + " parameters but '" +
+                m_prepared_ptr->query() + "' has " + std::to_string(m_prepared_ptr->parameter_count()) + ".");
+        }
+        check_parameters(std::index_sequence_for<params_type...>{});
+    }
+
+    /**
+     * @return The underlying prepared statement.
+     */
+    auto prepared() const -> const std::shared_ptr<priam::prepared>& { return m_prepared_ptr; }
+
+    /**
+     * Acquires a pooled statement and binds the parameters to it, see prepared::acquire_statement().
+     * @param params The parameters in bind position order.
+     * @return The statement and status::ok if every parameter was bound, otherwise the status of the first failure.
+     */
+    auto make_statement(const params_type&... params) const -> std::pair<statement, status>
+    {
+        auto s  = m_prepared_ptr->acquire_statement();
+        auto rc = s.bind_all(params...);
+        return {std::move(s), rc};
+    }
+
+    /**
+     * Checks the result's columns against columns_type and then calls 'row_callback' with every decoded row.
+     * @param result The result of executing a statement from this prepared statement.
+     * @param row_callback Functor taking a single parameter 'row_type&&'.
+     * @throws std::runtime_error If the column count or any column type does not match columns_type.
+     */
+    template<typename functor_type>
+    auto for_each(const result& result, functor_type&& row_callback) const -> void
+    {
+        const auto* cass_result = result.m_cass_result_ptr.get();
+        if (cass_result == nullptr)
+        {
+            return;
+        }
+        check_columns(cass_result, std::index_sequence_for<columns_type...>{});
+
+        cass_iterator_ptr cass_iterator_ptr{cass_iterator_from_result(cass_result)};
+        while (cass_iterator_next(cass_iterator_ptr.get()))
+        {
+            const CassRow* cass_row = cass_iterator_get_row(cass_iterator_ptr.get());
+            row_callback(decode_row(cass_row, std::index_sequence_for<columns_type...>{}));
+        }
+    }
+
+    /**
+     * Checks the result's columns against columns_type and decodes every row.  Columns decoded as views,
+     * e.g. std::string_view, borrow from 'result' and are only valid for its lifetime.
+     * @param result The result of executing a statement from this prepared statement.
+     * @throws std::runtime_error If the column count or any column type does not match columns_type.
+     * @return The decoded rows.
+     */
+    auto decode(const result& result) const -> std::vector<row_type>
+    {
+        std::vector<row_type> rows{};
+        rows.reserve(result.row_count());
+        for_each(result, [&rows](row_type&& row) { rows.emplace_back(std::move(row)); });
+        return rows;
+    }
+
+private:
+    /// The underlying prepared statement.
+    std::shared_ptr<priam::prepared> m_prepared_ptr{nullptr};
+
+    template<size_t... indexes>
+    auto check_parameters(std::index_sequence<indexes...>) const -> void
+    {
+        const auto* cass_prepared = m_prepared_ptr->m_cass_prepared_ptr.get();
+        (void)cass_prepared; // Unused without parameters.
+        (check_parameter<params_type>(cass_prepared, indexes), ...);
+    }
+
+    template<typename param_type>
+    auto check_parameter(const CassPrepared* cass_prepared, size_t position) const -> void
+    {
+        if (!codec_binds<param_type>(cass_prepared_parameter_data_type(cass_prepared, position)))
+        {
+            throw std::runtime_error(
+                "priam::typed_prepared: parameter " + std::to_string(position) + " '" +
+                std::string{m_prepared_ptr->parameter_name(position)} + "' of type " +
+                to_string(m_prepared_ptr->parameter_type(position)) + " does not match its C++ type.");
+        }
+    }
+
+    template<size_t... indexes>
+    static auto check_columns(const CassResult* cass_result, std::index_sequence<indexes...>) -> void
+    {
+        if (cass_result_column_count(cass_result) != sizeof...(columns_type))
+        {
+            throw std::runtime_error(
+                "priam::typed_prepared: expected " + std::to_string(sizeof...(columns_type)) +
+                " columns but the result has " + std::to_string(cass_result_column_count(cass_result)) + ".");
+        }
+        (check_column<columns_type>(cass_result, indexes), ...);
+    }
+
+    template<typename column_type>
+    static auto check_column(const CassResult* cass_result, size_t column) -> void
+    {
+        const auto* cass_data_type = cass_result_column_data_type(cass_result, column);
+        if (!codec<column_type>::accepts(cass_data_type))
+        {
+            throw std::runtime_error(
+                "priam::typed_prepared: column " + std::to_string(column) + " of type " +
+                to_string(to_data_type(cass_data_type)) + " does not match its C++ type.");
+        }
+    }
+
+    template<size_t... indexes>
+    static auto decode_row(const CassRow* cass_row, std::index_sequence<indexes...>) -> row_type
+    {
+        (void)cass_row; // Unused without columns.
+        return row_type{codec<columns_type>::decode(cass_row_get_column(cass_row, indexes))...};
+    }
+};
+
+} // namespace priam
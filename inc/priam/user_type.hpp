@@ -0,0 +1,96 @@
+#pragma once
+
+#include "priam/codec.hpp"
+#include "priam/collection.hpp"
+#include "priam/cpp_driver.hpp"
+
+#include <optional>
+#include <string_view>
+#include <type_traits>
+
+namespace priam
+{
+/**
+ * The fields of a Cassandra user defined type to bind to a statement, see statement::bind_user_type().
+ * Fields that are not set are null.
+ */
+class statement_user_type
+{
+    friend statement;
+    friend statement_collection;
+
+public:
+    /**
+     * @param cass_data_type The user defined type, e.g. from prepared::parameter_data_type() or the element type of
+     *                       a collection's data type.  It is borrowed and must outlive this object.
+     * @throws std::runtime_error If 'cass_data_type' is not a user defined type.
+     */
+    explicit statement_user_type(const CassDataType* cass_data_type);
+    statement_user_type(const statement_user_type&) = delete;
+    statement_user_type(statement_user_type&&)      = default;
+    auto operator=(const statement_user_type&) -> statement_user_type& = delete;
+    auto operator=(statement_user_type&&) -> statement_user_type& = default;
+    ~statement_user_type()                                        = default;
+
+    /**
+     * @return The number of fields in the user defined type.
+     */
+    auto field_count() const -> size_t;
+
+    /**
+     * Resolves a field name to its index, setting fields by index avoids searching the fields by name.
+     * @param name The field name.
+     * @return The index of the field, or std::nullopt if the type has no field 'name'.
+     */
+    auto field_index(std::string_view name) const -> std::optional<size_t>;
+
+    /**
+     * Sets a field using the driver function for its C++ type, see priam::codec.
+     * @param index The field index.
+     * @param value The field value, an empty std::optional sets null.
+     * @return True if the field was set.
+     */
+    template<typename value_type>
+    auto set(size_t index, const value_type& value) -> bool
+    {
+        return codec<std::decay_t<value_type>>::set(m_cass_user_type_ptr.get(), index, value) == CASS_OK;
+    }
+
+    /**
+     * @param name The field name, see field_index().
+     * @param value The field value, an empty std::optional sets null.
+     * @return True if the field was set.
+     */
+    template<typename value_type>
+    auto set(std::string_view name, const value_type& value) -> bool
+    {
+        auto index = field_index(name);
+        return index.has_value() && set(index.value(), value);
+    }
+
+    /**
+     * Sets every member of a struct described by a priam::mapping into the field of the same name.  The field
+     * positions are resolved once per data type and cached.  Nested mapped structs are set as nested user
+     * defined types.
+     * @param value The struct to set the fields from.
+     * @return True if every mapped member was set, false if a member has no field or could not be set.
+     */
+    template<typename value_type>
+    auto set_all(const value_type& value) -> bool
+    {
+        return codec<value_type>::set_all(m_cass_user_type_ptr.get(), m_cass_data_type, value) == CASS_OK;
+    }
+
+    /**
+     * @param index The field index to set to null.
+     * @return True if the field was set.
+     */
+    auto set_null(size_t index) -> bool;
+
+private:
+    /// The user defined type, borrowed.
+    const CassDataType* m_cass_data_type{nullptr};
+    cass_user_type_ptr  m_cass_user_type_ptr{nullptr};
+};
+
+} // namespace priam
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "priam/type.hpp"
+
+#include <cstddef>
+#include <string>
+#include <string_view>
+
+namespace priam
+{
+/// The length of a formatted uuid "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx", without a null terminator.
+constexpr size_t uuid_string_length = 36;
+
+/**
+ * Formats a uuid as lowercase hex without allocating.  The hex encoding uses SSSE3 or AVX2 when the CPU
+ * supports it, detected at runtime, with a scalar fallback.
+ * @param first The start of the output buffer, it must hold at least uuid_string_length characters.
+ * @param value The uuid to format.
+ * @return One past the last character written, the output is not null terminated.
+ */
+auto to_chars(char* first, const uuid& value) -> char*;
+
+/**
+ * Parses a uuid without allocating, hex digits may be either case.
+ * @param input A uuid in the form "xxxxxxxx-xxxx-xxxx-xxxx-xxxxxxxxxxxx", exactly uuid_string_length characters.
+ * @param value Set to the parsed uuid, it is left unchanged if 'input' is malformed.
+ * @return True if 'input' is a well formed uuid.
+ */
+auto from_chars(std::string_view input, uuid& value) -> bool;
+
+/**
+ * Converts a CassUuid into a 36 byte string representation.
+ * XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX
+ */
+auto to_string(uuid uuid) -> std::string;
+
+} // namespace priam
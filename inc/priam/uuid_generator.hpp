@@ -2,17 +2,13 @@
 
 #include "priam/cpp_driver.hpp"
 #include "priam/type.hpp"
+#include "priam/uuid.hpp"
 
-#include <string>
+#include <cstddef>
+#include <iterator>
 
 namespace priam
 {
-/**
- * Converts a CassUuid into a 36 byte string representation.
- * XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX
- */
-auto to_string(uuid uuid) -> std::string;
-
 class uuid_generator
 {
 public:
@@ -48,4 +44,57 @@ private:
     cass_uuid_gen_ptr m_uuid_gen_ptr{nullptr};
 };
 
+/**
+ * Generates time ordered uuids from state local to each thread, so threads generating uuids never contend.
+ * Unlike uuid_generator, which shares one clock sequence between every caller, each thread keeps its own
+ * last timestamp and every uuid a thread generates sorts after the previous one, even if the system clock
+ * steps backwards or many are generated within the same tick.
+ *
+ * Version 1 uuids use a random node, with the multicast bit set per RFC 4122, shared by the process and a
+ * clock sequence unique to each thread for up to 16384 threads.  Version 7 uuids, RFC 9562, use the unix
+ * epoch in milliseconds with a 12 bit counter for uuids generated within the same millisecond.  The random
+ * bits are not cryptographically secure.
+ */
+class thread_uuid_generator
+{
+public:
+    enum class version
+    {
+        v1,
+        v7
+    };
+
+    thread_uuid_generator() = delete;
+
+    /**
+     * @return Generates a timestamp uuid v1, it sorts after every uuid v1 previously generated on this thread.
+     */
+    static auto uuid_v1() -> uuid;
+
+    /**
+     * @return Generates a unix epoch timestamp uuid v7, it sorts after every uuid v7 previously generated on
+     *         this thread.
+     */
+    static auto uuid_v7() -> uuid;
+
+    /**
+     * Generates 'count' ordered uuids with a single clock read.  A large batch of uuid v1 can run ahead of the
+     * clock by 100ns per uuid, later uuids on this thread continue from the end of the batch.
+     * @param first The uuids to generate.
+     * @param count The number of uuids to generate.
+     * @param version The version of uuids to generate.
+     */
+    static auto generate(uuid* first, size_t count, version version = version::v1) -> void;
+
+    /**
+     * @param uuids A contiguous container of uuids, e.g. std::vector<priam::uuid>, to fill with ordered uuids.
+     * @param version The version of uuids to generate.
+     */
+    template<typename container_type>
+    static auto generate(container_type& uuids, version version = version::v1) -> void
+    {
+        generate(std::data(uuids), std::size(uuids), version);
+    }
+};
+
 } // namespace priam
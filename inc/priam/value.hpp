@@ -1,15 +1,22 @@
 #pragma once
 
 #include "priam/blob.hpp"
+#include "priam/chrono.hpp"
+#include "priam/codec.hpp"
 #include "priam/cpp_driver.hpp"
 #include "priam/decimal.hpp"
 #include "priam/duration.hpp"
+#include "priam/inet.hpp"
 #include "priam/type.hpp"
 
 #include <cstddef>
 #include <ctime>
+#include <iterator>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
 
 namespace priam
 {
@@ -44,9 +51,9 @@ public:
     auto is_null() const -> bool;
 
     /**
-     * @return The data type of this Value.
+     * @return The data type of this Value.  Values from a column_handle already know their type.
      */
-    auto type() const -> data_type;
+    auto type() const -> data_type { return (m_type != data_type::unknown) ? m_type : lookup_type(); }
 
     /**
      * @tparam d to see if this value is that type.
@@ -58,8 +65,36 @@ public:
         return type() == d;
     }
 
-    // TODO: implement
-    // auto as_custom() const -> void*;
+    /**
+     * @return Cassandra column data type 'custom' as its serialized bytes, borrowed from the result, it is only
+     *         valid for the result's lifetime.  If the value is null then std::nullopt is returned.
+     */
+    auto as_custom() const -> std::optional<blob>;
+
+    /**
+     * Decodes a Cassandra 5 'vector<float, N>' column, which the driver reports as a custom type, into a caller
+     * buffer.  The big endian elements are copied and byte swapped in bulk with SIMD instructions.
+     * @param output The buffer to decode into.
+     * @param capacity The number of elements 'output' can hold.
+     * @return The number of elements decoded.  If the value is null, is not a whole number of elements or does
+     *         not fit in 'capacity' then std::nullopt is returned.
+     */
+    auto as_vector(float* output, size_t capacity) const -> std::optional<size_t>;
+
+    /**
+     * Decodes a Cassandra 5 'vector<double, N>' column into a caller buffer, see as_vector(float*, size_t).
+     */
+    auto as_vector(double* output, size_t capacity) const -> std::optional<size_t>;
+
+    /**
+     * @param output A contiguous container to decode into, e.g. std::array<float, 768> or a sized std::vector.
+     * @return The number of elements decoded, see as_vector(float*, size_t).
+     */
+    template<typename container_type>
+    auto as_vector(container_type& output) const -> std::optional<size_t>
+    {
+        return as_vector(std::data(output), std::size(output));
+    }
 
     /**
      * @return Cassandra column data type 'ascii' into std::string.
@@ -67,6 +102,19 @@ public:
      */
     auto as_ascii() const -> std::optional<std::string>;
 
+    /**
+     * @return Cassandra column data type 'ascii' as a view borrowed from the result, it is only valid for the
+     *         result's lifetime.  If the value is null then std::nullopt is returned.
+     */
+    auto as_ascii_view() const -> std::optional<std::string_view>;
+
+    /**
+     * Decodes Cassandra column data type 'ascii' into an existing string, reusing its capacity.
+     * @param output The string to assign the value to, it is left unchanged if the value is null.
+     * @return True if the value was assigned, false if the value is null.
+     */
+    auto as_ascii(std::string& output) const -> bool;
+
     /**
      * @return Cassandra column data type 'bigint' into int64_t.
      *         If the value is null then std::nullopt is returned.
@@ -74,8 +122,8 @@ public:
     auto as_big_int() const -> std::optional<int64_t>;
 
     /**
-     * @return Cassandra column data type 'blob' into Blob.
-     *         If the value is null then std::nullopt is returned.
+     * @return Cassandra column data type 'blob' into Blob, it borrows from the result and is only valid for
+     *         the result's lifetime.  If the value is null then std::nullopt is returned.
      */
     auto as_blob() const -> std::optional<blob>;
 
@@ -122,13 +170,27 @@ public:
     auto as_text() const -> std::optional<std::string>;
 
     /**
-     * @return Cassandra column data type 'timestamp' into std::time_t.
+     * @return Cassandra column data type 'text' as a view borrowed from the result, it is only valid for the
+     *         result's lifetime.  If the value is null then std::nullopt is returned.
+     */
+    auto as_text_view() const -> std::optional<std::string_view>;
+
+    /**
+     * Decodes Cassandra column data type 'text' into an existing string, reusing its capacity.
+     * @param output The string to assign the value to, it is left unchanged if the value is null.
+     * @return True if the value was assigned, false if the value is null.
+     */
+    auto as_text(std::string& output) const -> bool;
+
+    /**
+     * @return Cassandra column data type 'timestamp' into milliseconds since the unix epoch.
      *         If the value is null then std::nullopt is returned.
      */
-    auto as_timestamp() const -> std::optional<std::time_t>;
+    auto as_timestamp() const -> std::optional<timestamp>;
 
     /**
-     * @return Cassandra column data type 'timestamp' into a date formatted timestamp.
+     * @return Cassandra column data type 'timestamp' into an ISO-8601 formatted timestamp, see to_iso8601()
+     *         to format into a caller buffer without allocating.
      *         If the value is null then std::nullopt is returned.
      */
     auto as_timestamp_date_formatted() const -> std::optional<std::string>;
@@ -146,10 +208,23 @@ public:
     auto as_varchar() const -> std::optional<std::string>;
 
     /**
-     * @return Cassandra column data type 'varint' into blob.  The blob contains the variable integer raw information.
+     * @return Cassandra column data type 'varchar' as a view borrowed from the result, it is only valid for the
+     *         result's lifetime.  If the value is null then std::nullopt is returned.
+     */
+    auto as_varchar_view() const -> std::optional<std::string_view>;
+
+    /**
+     * Decodes Cassandra column data type 'varchar' into an existing string, reusing its capacity.
+     * @param output The string to assign the value to, it is left unchanged if the value is null.
+     * @return True if the value was assigned, false if the value is null.
+     */
+    auto as_varchar(std::string& output) const -> bool;
+
+    /**
+     * @return Cassandra column data type 'varint' into an arbitrary precision integer.
      *         If the value is null then std::nullopt is returned.
      */
-    auto as_varint() const -> std::optional<blob>;
+    auto as_varint() const -> std::optional<varint>;
 
     /**
      * @return Cassandra column data type 'time uuid' into std::string.
@@ -158,10 +233,10 @@ public:
     auto as_time_uuid() const -> std::optional<uuid>;
 
     /**
-     * @return Cassandra column data type 'inet' into std::string.
+     * @return Cassandra column data type 'inet' into priam::inet, see inet::to_chars() to format it.
      *         If the value is null then std::nullopt is returned.
      */
-    auto as_inet() const -> std::optional<std::string>;
+    auto as_inet() const -> std::optional<inet>;
 
     /**
      * @see http://datastax.github.io/cpp-driver/topics/basics/date_and_time/
@@ -170,6 +245,12 @@ public:
      */
     auto as_date() const -> std::optional<uint32_t>;
 
+    /**
+     * @return Cassandra data type 'date' into a system clock date.
+     *         If the value is null then std::nullopt is returned.
+     */
+    auto as_sys_days() const -> std::optional<sys_days>;
+
     /**
      * @see http://datastax.github.io/cpp-driver/topics/basics/date_and_time/
      * @return Cassandra data type 'time' into int64_t.
@@ -177,6 +258,12 @@ public:
      */
     auto as_time() const -> std::optional<int64_t>;
 
+    /**
+     * @return Cassandra data type 'time' into the time since midnight.
+     *         If the value is null then std::nullopt is returned.
+     */
+    auto as_time_of_day() const -> std::optional<std::chrono::nanoseconds>;
+
     /**
      * @return Cassandra data type 'smallint' into int16_t.
      *         If the value is null then std::nullopt is returned.
@@ -201,20 +288,77 @@ public:
      */
     auto as_list() const -> std::optional<priam::result_list>;
 
+    /**
+     * Decodes a Cassandra data type 'list' into a std::vector in one pass.  Fixed width elements, e.g. int, bigint
+     * and double, are copied and byte swapped in bulk rather than through a driver iterator per element.
+     * @tparam element_type Any type with a priam::codec, e.g. int64_t or std::string.
+     * @return The elements, or std::nullopt if the value is null.
+     */
+    template<typename element_type>
+    auto as_list() const -> std::optional<std::vector<element_type>>
+    {
+        if (is_null())
+        {
+            return std::nullopt;
+        }
+        return {codec<std::vector<element_type>>::decode(m_cass_value)};
+    }
+
     /**
      * @return Cassandra data type 'map' into priam::map.
      *         If the value is null then std::nullopt is returned.
      */
     auto as_map() const -> std::optional<priam::map>;
 
+    /**
+     * Decodes a Cassandra data type 'map' into a std::unordered_map sized up front, fixed width keys and values
+     * are decoded in bulk, see as_list<element_type>().
+     * @return The entries, or std::nullopt if the value is null.
+     */
+    template<typename key_type, typename mapped_type>
+    auto as_map() const -> std::optional<std::unordered_map<key_type, mapped_type>>
+    {
+        if (is_null())
+        {
+            return std::nullopt;
+        }
+        return {codec<std::unordered_map<key_type, mapped_type>>::decode(m_cass_value)};
+    }
+
     /**
      * @return Cassandra data type 'set' into priam::set.
      *         If the value is null then std::nullopt is returned.
      */
     auto as_set() const -> std::optional<priam::set>;
 
-    // TODO: implement
-    // auto as_udt() const -> priam::udt;
+    /**
+     * Decodes a Cassandra data type 'set' into a std::vector in the set's sorted order, see
+     * as_list<element_type>().
+     * @return The elements, or std::nullopt if the value is null.
+     */
+    template<typename element_type>
+    auto as_set() const -> std::optional<std::vector<element_type>>
+    {
+        return as_list<element_type>();
+    }
+
+    /**
+     * Decodes a Cassandra user defined type into a struct described by a priam::mapping.  Fields are matched to
+     * members by name once per data type, then decoded straight into the members, including nested user defined
+     * types and collections.
+     * @tparam value_type The struct to decode into.
+     * @throws std::runtime_error If a member's type does not match its field's type.
+     * @return The struct, or std::nullopt if the value is null.
+     */
+    template<typename value_type>
+    auto as_udt() const -> std::optional<value_type>
+    {
+        if (is_null())
+        {
+            return std::nullopt;
+        }
+        return {codec<value_type>::decode(m_cass_value)};
+    }
 
     /**
      * @return Cassandra data type 'tuple' into priam::Tuple.
@@ -225,12 +369,26 @@ public:
 private:
     /// The underlying cassandra value for this column/value, this object does not need to be free'ed.
     const CassValue* m_cass_value{nullptr};
+    /// The data type of this value if it is known up front.
+    data_type m_type{data_type::unknown};
 
     /**
      * Creates a column/value out of the underlying cassandra column/value.
      * @param cass_column Pointer to the cassandra driver value for this column.
      */
     explicit value(const CassValue* cass_column);
+
+    /**
+     * Creates a column/value whose data type is already known.
+     * @param cass_column Pointer to the cassandra driver value for this column.
+     * @param type The data type of the column.
+     */
+    value(const CassValue* cass_column, data_type type);
+
+    /**
+     * @return The data type of this value from the driver.
+     */
+    auto lookup_type() const -> data_type;
 };
 
 } // namespace priam
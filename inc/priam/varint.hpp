@@ -0,0 +1,114 @@
+#pragma once
+
+#include "priam/blob.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace priam
+{
+/// A signed 128 bit integer, the widest integer a varint converts to without allocating.
+__extension__ typedef __int128 int128_t;
+
+/**
+ * Cassandra 'varint', an arbitrary precision integer encoded as big endian two's complement bytes.  The bytes
+ * are kept in their shortest encoding, values of up to 16 bytes, every int128_t, are stored inline without
+ * allocating.
+ */
+class varint
+{
+public:
+    /// Encodings up to this many bytes are stored inline.
+    static constexpr size_t inline_capacity = 16;
+
+    /**
+     * Zero.
+     */
+    varint() : varint(int64_t{0}) {}
+
+    /**
+     * @param value The integer value.
+     */
+    explicit varint(int64_t value);
+
+    /**
+     * @param value The integer value.
+     */
+    explicit varint(int128_t value);
+
+    /**
+     * @param data Big endian two's complement bytes, they are copied.  No bytes is zero.
+     * @param size The number of bytes in 'data'.
+     */
+    varint(const std::byte* data, size_t size);
+
+    /**
+     * @param bytes Big endian two's complement bytes, they are copied.
+     */
+    explicit varint(const blob& bytes) : varint(bytes.data(), bytes.size()) {}
+
+    /**
+     * @param digits A base 10 integer with an optional sign, e.g. "-123456789012345678901234567890".
+     * @return The integer, or std::nullopt if 'digits' is malformed.
+     */
+    static auto from_string(std::string_view digits) -> std::optional<varint>;
+
+    /**
+     * @return The big endian two's complement bytes.
+     */
+    auto data() const -> const std::byte* { return (m_size <= inline_capacity) ? m_inline.data() : m_heap.data(); }
+
+    /**
+     * @return The number of bytes in the encoding.
+     */
+    auto size() const -> size_t { return m_size; }
+
+    /**
+     * @return True if the value is less than zero.
+     */
+    auto is_negative() const -> bool { return m_size > 0 && (std::to_integer<uint8_t>(data()[0]) & 0x80) != 0; }
+
+    /**
+     * @return The value, or std::nullopt if it does not fit into an int64_t.
+     */
+    auto to_int64() const -> std::optional<int64_t>;
+
+    /**
+     * @return The value, or std::nullopt if it does not fit into an int128_t.
+     */
+    auto to_int128() const -> std::optional<int128_t>;
+
+    /**
+     * @return The nearest double, values beyond int128_t are accumulated a byte at a time and may differ in the
+     *         last place.
+     */
+    auto to_double() const -> double;
+
+    /**
+     * @return The exact base 10 value, e.g. "-123456789012345678901234567890".
+     */
+    auto to_string() const -> std::string;
+
+    auto operator==(const varint& other) const -> bool;
+    auto operator!=(const varint& other) const -> bool { return !(*this == other); }
+
+private:
+    /// The encoding when it fits inline.
+    std::array<std::byte, inline_capacity> m_inline{};
+    /// The encoding when it is larger than inline_capacity.
+    std::vector<std::byte> m_heap{};
+    /// The number of bytes in the encoding.
+    size_t m_size{0};
+
+    /**
+     * Stores the shortest encoding of the big endian two's complement bytes.
+     */
+    auto assign(const std::byte* data, size_t size) -> void;
+};
+
+} // namespace priam
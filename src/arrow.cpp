@@ -0,0 +1,898 @@
+#include "priam/arrow.hpp"
+#include "priam/byte_order.hpp"
+#include "priam/status.hpp"
+
+#include <cerrno>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace priam
+{
+namespace
+{
+/**
+ * The layout of a column, exported as an ArrowSchema once per result and for every get_schema() of a stream.
+ */
+struct schema_node
+{
+    /// The Arrow format string.
+    std::string format{};
+    /// The field name.
+    std::string name{};
+    /// The Arrow field flags.
+    int64_t flags{ARROW_FLAG_NULLABLE};
+    /// The child fields of nested types.
+    std::vector<schema_node> children{};
+};
+
+auto same_layout(const schema_node& lhs, const schema_node& rhs) -> bool
+{
+    if (lhs.format != rhs.format || lhs.name != rhs.name || lhs.children.size() != rhs.children.size())
+    {
+        return false;
+    }
+    for (size_t i = 0; i < lhs.children.size(); ++i)
+    {
+        if (!same_layout(lhs.children[i], rhs.children[i]))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto make_schema_node(const CassDataType* cass_data_type, std::string name, int64_t flags = ARROW_FLAG_NULLABLE)
+    -> schema_node
+{
+    auto        type = to_data_type(cass_data_type);
+    schema_node node{std::string{to_arrow_format(type)}, std::move(name), flags, {}};
+
+    switch (type)
+    {
+        case data_type::list:
+        case data_type::set:
+            node.children.push_back(make_schema_node(cass_data_type_sub_data_type(cass_data_type, 0), "item"));
+            break;
+        case data_type::map:
+        {
+            // Arrow maps are a list of non-null key/value structs with non-null keys.
+            schema_node entries{"+s", "entries", 0, {}};
+            entries.children.push_back(make_schema_node(cass_data_type_sub_data_type(cass_data_type, 0), "key", 0));
+            entries.children.push_back(make_schema_node(cass_data_type_sub_data_type(cass_data_type, 1), "value"));
+            node.children.push_back(std::move(entries));
+        }
+        break;
+        case data_type::tuple:
+            for (size_t i = 0; i < cass_data_type_sub_type_count(cass_data_type); ++i)
+            {
+                node.children.push_back(
+                    make_schema_node(cass_data_type_sub_data_type(cass_data_type, i), std::to_string(i)));
+            }
+            break;
+        case data_type::udt:
+            for (size_t i = 0; i < cass_data_type_sub_type_count(cass_data_type); ++i)
+            {
+                const char* field_name{nullptr};
+                size_t      field_name_length{0};
+                cass_data_type_sub_type_name(cass_data_type, i, &field_name, &field_name_length);
+                node.children.push_back(make_schema_node(
+                    cass_data_type_sub_data_type(cass_data_type, i), std::string{field_name, field_name_length}));
+            }
+            break;
+        default:
+            break;
+    }
+
+    return node;
+}
+
+/**
+ * Owns the strings and children of an exported ArrowSchema.
+ */
+struct schema_private
+{
+    std::string               format{};
+    std::string               name{};
+    std::vector<ArrowSchema>  children{};
+    std::vector<ArrowSchema*> child_pointers{};
+};
+
+auto release_schema(ArrowSchema* schema) -> void
+{
+    auto* data = static_cast<schema_private*>(schema->private_data);
+    for (auto& child : data->children)
+    {
+        if (child.release != nullptr)
+        {
+            child.release(&child);
+        }
+    }
+    delete data;
+    schema->release = nullptr;
+}
+
+auto export_schema(const schema_node& node, ArrowSchema* out) -> void
+{
+    auto data    = std::make_unique<schema_private>();
+    data->format = node.format;
+    data->name   = node.name;
+    data->children.resize(node.children.size());
+    for (size_t i = 0; i < node.children.size(); ++i)
+    {
+        export_schema(node.children[i], &data->children[i]);
+        data->child_pointers.push_back(&data->children[i]);
+    }
+
+    out->format       = data->format.c_str();
+    out->name         = data->name.c_str();
+    out->metadata     = nullptr;
+    out->flags        = node.flags;
+    out->n_children   = static_cast<int64_t>(data->children.size());
+    out->children     = data->child_pointers.empty() ? nullptr : data->child_pointers.data();
+    out->dictionary   = nullptr;
+    out->release      = release_schema;
+    out->private_data = data.release();
+}
+
+/**
+ * Owns the buffers and children of an exported ArrowArray.
+ */
+struct array_private
+{
+    std::vector<std::vector<uint8_t>> buffers{};
+    std::vector<const void*>          buffer_pointers{};
+    std::vector<ArrowArray>           children{};
+    std::vector<ArrowArray*>          child_pointers{};
+};
+
+auto release_array(ArrowArray* array) -> void
+{
+    auto* data = static_cast<array_private*>(array->private_data);
+    for (auto& child : data->children)
+    {
+        if (child.release != nullptr)
+        {
+            child.release(&child);
+        }
+    }
+    delete data;
+    array->release = nullptr;
+}
+
+auto export_array(
+    int64_t                           length,
+    int64_t                           null_count,
+    std::vector<std::vector<uint8_t>> buffers,
+    std::vector<ArrowArray>           children,
+    ArrowArray*                       out) -> void
+{
+    auto data      = std::make_unique<array_private>();
+    data->buffers  = std::move(buffers);
+    data->children = std::move(children);
+    for (const auto& buffer : data->buffers)
+    {
+        // Empty buffers, including the validity of arrays without nulls, are exported as nullptr.
+        data->buffer_pointers.push_back(buffer.empty() ? nullptr : buffer.data());
+    }
+    for (auto& child : data->children)
+    {
+        data->child_pointers.push_back(&child);
+    }
+
+    out->length       = length;
+    out->null_count   = null_count;
+    out->offset       = 0;
+    out->n_buffers    = static_cast<int64_t>(data->buffer_pointers.size());
+    out->n_children   = static_cast<int64_t>(data->child_pointers.size());
+    out->buffers      = data->buffer_pointers.empty() ? nullptr : data->buffer_pointers.data();
+    out->children     = data->child_pointers.empty() ? nullptr : data->child_pointers.data();
+    out->dictionary   = nullptr;
+    out->release      = release_array;
+    out->private_data = data.release();
+}
+
+template<typename value_type>
+auto append_bytes(std::vector<uint8_t>& buffer, const value_type& value) -> void
+{
+    auto size = buffer.size();
+    buffer.resize(size + sizeof(value_type));
+    std::memcpy(buffer.data() + size, &value, sizeof(value_type));
+}
+
+/**
+ * Decodes the values of a single column, or of a nested type's child, into Arrow buffers.
+ */
+class column_builder
+{
+public:
+    column_builder()                      = default;
+    column_builder(const column_builder&) = delete;
+    column_builder(column_builder&&)      = delete;
+    auto operator=(const column_builder&) -> column_builder& = delete;
+    auto operator=(column_builder &&) -> column_builder& = delete;
+
+    virtual ~column_builder() = default;
+
+    /**
+     * @param cass_value The value to append, nullptr or a null value appends a null.
+     */
+    auto append(const CassValue* cass_value) -> void
+    {
+        auto valid = cass_value != nullptr && !cass_value_is_null(cass_value) && append_value(cass_value);
+        if (!valid)
+        {
+            append_null();
+        }
+        mark(valid);
+    }
+
+    /**
+     * Exports the appended values, the builder is empty afterwards.
+     * @param out The array to export into.
+     */
+    auto finish(ArrowArray* out) -> void
+    {
+        std::vector<std::vector<uint8_t>> buffers{};
+        buffers.push_back((m_null_count > 0) ? std::move(m_validity) : std::vector<uint8_t>{});
+        std::vector<ArrowArray> children{};
+        finish_buffers(buffers, children);
+        export_array(m_length, m_null_count, std::move(buffers), std::move(children), out);
+    }
+
+protected:
+    /**
+     * @param cass_value A non-null value to append.
+     * @return False if the value could not be decoded and nothing was appended, it is appended as a null.
+     */
+    virtual auto append_value(const CassValue* cass_value) -> bool = 0;
+
+    /**
+     * Appends the placeholder for a null value.
+     */
+    virtual auto append_null() -> void = 0;
+
+    /**
+     * @param buffers The array's buffers after the validity bitmap.
+     * @param children The array's children.
+     */
+    virtual auto finish_buffers(std::vector<std::vector<uint8_t>>& buffers, std::vector<ArrowArray>& children)
+        -> void = 0;
+
+    /**
+     * Records the validity of the next slot.
+     */
+    auto mark(bool valid) -> void
+    {
+        if (m_length % 8 == 0)
+        {
+            m_validity.push_back(0);
+        }
+        if (valid)
+        {
+            m_validity.back() |= static_cast<uint8_t>(1U << (m_length % 8));
+        }
+        else
+        {
+            ++m_null_count;
+        }
+        ++m_length;
+    }
+
+private:
+    /// The number of appended values.
+    int64_t m_length{0};
+    /// The number of appended nulls.
+    int64_t m_null_count{0};
+    /// One bit per value, set when the value is not null.
+    std::vector<uint8_t> m_validity{};
+};
+
+/**
+ * Copies the raw network order bytes of fixed width values and converts them in bulk when finished.
+ */
+class fixed_builder : public column_builder
+{
+public:
+    using convert_type = void (*)(uint8_t* values, size_t count);
+
+    /**
+     * @param width The width of each value in bytes.
+     * @param convert Converts the network order values to their Arrow representation, nullptr to keep them as is.
+     */
+    fixed_builder(size_t width, convert_type convert) : m_width(width), m_convert(convert) {}
+
+protected:
+    auto append_value(const CassValue* cass_value) -> bool override
+    {
+        const cass_byte_t* bytes{nullptr};
+        size_t             size{0};
+        if (cass_value_get_bytes(cass_value, &bytes, &size) != CASS_OK || size != m_width)
+        {
+            return false;
+        }
+        m_values.insert(m_values.end(), bytes, bytes + size);
+        return true;
+    }
+
+    auto append_null() -> void override { m_values.resize(m_values.size() + m_width); }
+
+    auto finish_buffers(std::vector<std::vector<uint8_t>>& buffers, std::vector<ArrowArray>&) -> void override
+    {
+        if (m_convert != nullptr)
+        {
+            m_convert(m_values.data(), m_values.size() / m_width);
+        }
+        buffers.push_back(std::move(m_values));
+    }
+
+private:
+    /// The width of each value in bytes.
+    size_t m_width{0};
+    /// Converts the values when finished.
+    convert_type m_convert{nullptr};
+    /// The values.
+    std::vector<uint8_t> m_values{};
+};
+
+auto convert_16(uint8_t* values, size_t count) -> void
+{
+    big_endian_to_host(reinterpret_cast<uint16_t*>(values), count);
+}
+
+auto convert_32(uint8_t* values, size_t count) -> void
+{
+    big_endian_to_host(reinterpret_cast<uint32_t*>(values), count);
+}
+
+auto convert_64(uint8_t* values, size_t count) -> void
+{
+    big_endian_to_host(reinterpret_cast<uint64_t*>(values), count);
+}
+
+auto convert_date(uint8_t* values, size_t count) -> void
+{
+    auto* days = reinterpret_cast<uint32_t*>(values);
+    big_endian_to_host(days, count);
+    // Cassandra dates center the epoch at 2^31, flipping the top bit makes them signed days since the epoch.
+    for (size_t i = 0; i < count; ++i)
+    {
+        days[i] ^= 1U << 31U;
+    }
+}
+
+/**
+ * Packs boolean values into a bitmap.
+ */
+class boolean_builder : public column_builder
+{
+protected:
+    auto append_value(const CassValue* cass_value) -> bool override
+    {
+        cass_bool_t value{cass_false};
+        if (cass_value_get_bool(cass_value, &value) != CASS_OK)
+        {
+            return false;
+        }
+        push(value == cass_true);
+        return true;
+    }
+
+    auto append_null() -> void override { push(false); }
+
+    auto finish_buffers(std::vector<std::vector<uint8_t>>& buffers, std::vector<ArrowArray>&) -> void override
+    {
+        buffers.push_back(std::move(m_values));
+    }
+
+private:
+    /// The number of values.
+    size_t m_count{0};
+    /// One bit per value.
+    std::vector<uint8_t> m_values{};
+
+    auto push(bool value) -> void
+    {
+        if (m_count % 8 == 0)
+        {
+            m_values.push_back(0);
+        }
+        if (value)
+        {
+            m_values.back() |= static_cast<uint8_t>(1U << (m_count % 8));
+        }
+        ++m_count;
+    }
+};
+
+/**
+ * Copies the raw bytes of variable width values, text is already utf8 and every other type keeps its CQL encoding.
+ */
+class binary_builder : public column_builder
+{
+public:
+    binary_builder() { append_bytes(m_offsets, int32_t{0}); }
+
+protected:
+    auto append_value(const CassValue* cass_value) -> bool override
+    {
+        const cass_byte_t* bytes{nullptr};
+        size_t             size{0};
+        if (cass_value_get_bytes(cass_value, &bytes, &size) != CASS_OK)
+        {
+            return false;
+        }
+        if (m_data.size() + size > static_cast<size_t>(std::numeric_limits<int32_t>::max()))
+        {
+            throw std::runtime_error("priam::arrow: a text or binary column exceeds 2GB.");
+        }
+        m_data.insert(m_data.end(), bytes, bytes + size);
+        append_bytes(m_offsets, static_cast<int32_t>(m_data.size()));
+        return true;
+    }
+
+    auto append_null() -> void override { append_bytes(m_offsets, static_cast<int32_t>(m_data.size())); }
+
+    auto finish_buffers(std::vector<std::vector<uint8_t>>& buffers, std::vector<ArrowArray>&) -> void override
+    {
+        buffers.push_back(std::move(m_offsets));
+        buffers.push_back(std::move(m_data));
+    }
+
+private:
+    /// The int32 offset of each value into the data, plus the end offset.
+    std::vector<uint8_t> m_offsets{};
+    /// The bytes of every value.
+    std::vector<uint8_t> m_data{};
+};
+
+/**
+ * Decodes durations into Arrow's month, day, nanosecond intervals.
+ */
+class duration_builder : public column_builder
+{
+protected:
+    auto append_value(const CassValue* cass_value) -> bool override
+    {
+        cass_int32_t months{0};
+        cass_int32_t days{0};
+        cass_int64_t nanos{0};
+        if (cass_value_get_duration(cass_value, &months, &days, &nanos) != CASS_OK)
+        {
+            return false;
+        }
+        append_bytes(m_values, months);
+        append_bytes(m_values, days);
+        append_bytes(m_values, nanos);
+        return true;
+    }
+
+    auto append_null() -> void override { m_values.resize(m_values.size() + 16); }
+
+    auto finish_buffers(std::vector<std::vector<uint8_t>>& buffers, std::vector<ArrowArray>&) -> void override
+    {
+        buffers.push_back(std::move(m_values));
+    }
+
+private:
+    /// The months, days and nanoseconds of every value.
+    std::vector<uint8_t> m_values{};
+};
+
+/**
+ * Decodes tuples, user defined types, map entries and rows into a struct with a child per field.
+ */
+class struct_builder : public column_builder
+{
+public:
+    /**
+     * @param children The builder of each field.
+     * @param udt True to decode user defined type values, otherwise tuple values.
+     */
+    struct_builder(std::vector<std::unique_ptr<column_builder>> children, bool udt)
+        : m_children(std::move(children)),
+          m_udt(udt)
+    {
+    }
+
+    /**
+     * Appends a non-null struct.
+     * @param field Functor taking a field index and returning its value.
+     */
+    template<typename functor_type>
+    auto append_fields(functor_type&& field) -> void
+    {
+        for (size_t i = 0; i < m_children.size(); ++i)
+        {
+            m_children[i]->append(field(i));
+        }
+        mark(true);
+    }
+
+protected:
+    auto append_value(const CassValue* cass_value) -> bool override
+    {
+        cass_iterator_ptr cass_iterator_ptr{
+            m_udt ? cass_iterator_fields_from_user_type(cass_value) : cass_iterator_from_tuple(cass_value)};
+        if (cass_iterator_ptr == nullptr)
+        {
+            return false;
+        }
+
+        for (auto& child : m_children)
+        {
+            // Trailing fields missing from the value are null.
+            const CassValue* field{nullptr};
+            if (cass_iterator_next(cass_iterator_ptr.get()))
+            {
+                field = m_udt ? cass_iterator_get_user_type_field_value(cass_iterator_ptr.get())
+                              : cass_iterator_get_value(cass_iterator_ptr.get());
+            }
+            child->append(field);
+        }
+        return true;
+    }
+
+    auto append_null() -> void override
+    {
+        for (auto& child : m_children)
+        {
+            child->append(nullptr);
+        }
+    }
+
+    auto finish_buffers(std::vector<std::vector<uint8_t>>&, std::vector<ArrowArray>& children) -> void override
+    {
+        children.resize(m_children.size());
+        for (size_t i = 0; i < m_children.size(); ++i)
+        {
+            m_children[i]->finish(&children[i]);
+        }
+    }
+
+private:
+    /// The builder of each field.
+    std::vector<std::unique_ptr<column_builder>> m_children{};
+    /// True for user defined types, false for tuples.
+    bool m_udt{false};
+};
+
+/**
+ * Decodes lists and sets into an Arrow list, and maps into an Arrow map of key/value entries.
+ */
+class list_builder : public column_builder
+{
+public:
+    /**
+     * @param child The builder of the items, or of the key/value entries of a map.
+     * @param map True to decode map values, otherwise list and set values.
+     */
+    list_builder(std::unique_ptr<column_builder> child, bool map) : m_child(std::move(child)), m_map(map)
+    {
+        append_bytes(m_offsets, int32_t{0});
+    }
+
+protected:
+    auto append_value(const CassValue* cass_value) -> bool override
+    {
+        cass_iterator_ptr cass_iterator_ptr{
+            m_map ? cass_iterator_from_map(cass_value) : cass_iterator_from_collection(cass_value)};
+        if (cass_iterator_ptr == nullptr)
+        {
+            return false;
+        }
+
+        while (cass_iterator_next(cass_iterator_ptr.get()))
+        {
+            if (m_map)
+            {
+                const CassValue* entry[2] = {
+                    cass_iterator_get_map_key(cass_iterator_ptr.get()),
+                    cass_iterator_get_map_value(cass_iterator_ptr.get())};
+                static_cast<struct_builder&>(*m_child).append_fields([&entry](size_t i) { return entry[i]; });
+            }
+            else
+            {
+                m_child->append(cass_iterator_get_value(cass_iterator_ptr.get()));
+            }
+            ++m_count;
+        }
+        append_bytes(m_offsets, static_cast<int32_t>(m_count));
+        return true;
+    }
+
+    auto append_null() -> void override { append_bytes(m_offsets, static_cast<int32_t>(m_count)); }
+
+    auto finish_buffers(std::vector<std::vector<uint8_t>>& buffers, std::vector<ArrowArray>& children)
+        -> void override
+    {
+        buffers.push_back(std::move(m_offsets));
+        children.resize(1);
+        m_child->finish(&children[0]);
+    }
+
+private:
+    /// The builder of the items or map entries.
+    std::unique_ptr<column_builder> m_child{nullptr};
+    /// True for maps, false for lists and sets.
+    bool m_map{false};
+    /// The total number of items.
+    size_t m_count{0};
+    /// The int32 offset of each value into the items, plus the end offset.
+    std::vector<uint8_t> m_offsets{};
+};
+
+auto make_builder(const CassDataType* cass_data_type) -> std::unique_ptr<column_builder>
+{
+    switch (to_data_type(cass_data_type))
+    {
+        case data_type::tinyint:
+            return std::make_unique<fixed_builder>(1, nullptr);
+        case data_type::smallint:
+            return std::make_unique<fixed_builder>(2, convert_16);
+        case data_type::int_t:
+        case data_type::float_t:
+            return std::make_unique<fixed_builder>(4, convert_32);
+        case data_type::date:
+            return std::make_unique<fixed_builder>(4, convert_date);
+        case data_type::bigint:
+        case data_type::counter:
+        case data_type::timestamp:
+        case data_type::time:
+        case data_type::double_t:
+            return std::make_unique<fixed_builder>(8, convert_64);
+        case data_type::uuid:
+        case data_type::timeuuid:
+            return std::make_unique<fixed_builder>(16, nullptr);
+        case data_type::boolean:
+            return std::make_unique<boolean_builder>();
+        case data_type::duration:
+            return std::make_unique<duration_builder>();
+        case data_type::list:
+        case data_type::set:
+            return std::make_unique<list_builder>(make_builder(cass_data_type_sub_data_type(cass_data_type, 0)), false);
+        case data_type::map:
+        {
+            std::vector<std::unique_ptr<column_builder>> entries{};
+            entries.push_back(make_builder(cass_data_type_sub_data_type(cass_data_type, 0)));
+            entries.push_back(make_builder(cass_data_type_sub_data_type(cass_data_type, 1)));
+            return std::make_unique<list_builder>(std::make_unique<struct_builder>(std::move(entries), false), true);
+        }
+        case data_type::tuple:
+        case data_type::udt:
+        {
+            std::vector<std::unique_ptr<column_builder>> fields{};
+            for (size_t i = 0; i < cass_data_type_sub_type_count(cass_data_type); ++i)
+            {
+                fields.push_back(make_builder(cass_data_type_sub_data_type(cass_data_type, i)));
+            }
+            return std::make_unique<struct_builder>(
+                std::move(fields), to_data_type(cass_data_type) == data_type::udt);
+        }
+        default:
+            return std::make_unique<binary_builder>();
+    }
+}
+
+} // namespace
+
+/**
+ * Reads results for the Arrow exports.
+ */
+class arrow_exporter
+{
+public:
+    /**
+     * @param result The result to describe.
+     * @throws std::runtime_error If the result failed.
+     * @return The layout of the result's rows.
+     */
+    static auto schema(const result& result) -> schema_node
+    {
+        const auto* cass_result = checked(result);
+
+        schema_node node{"+s", "", 0, {}};
+        for (const auto& column : result.columns())
+        {
+            const auto* cass_data_type = cass_result_column_data_type(cass_result, column.index());
+            node.children.push_back(make_schema_node(cass_data_type, std::string{column.name()}));
+        }
+        return node;
+    }
+
+    /**
+     * @param result The result to export.
+     * @param out The array to export into.
+     * @throws std::runtime_error If the result failed.
+     */
+    static auto array(const result& result, ArrowArray* out) -> void
+    {
+        const auto* cass_result = checked(result);
+
+        std::vector<std::unique_ptr<column_builder>> columns{};
+        for (const auto& column : result.columns())
+        {
+            columns.push_back(make_builder(cass_result_column_data_type(cass_result, column.index())));
+        }
+        struct_builder rows{std::move(columns), false};
+
+        cass_iterator_ptr cass_iterator_ptr{cass_iterator_from_result(cass_result)};
+        while (cass_iterator_next(cass_iterator_ptr.get()))
+        {
+            const CassRow* cass_row = cass_iterator_get_row(cass_iterator_ptr.get());
+            rows.append_fields([cass_row](size_t i) { return cass_row_get_column(cass_row, i); });
+        }
+        rows.finish(out);
+    }
+
+private:
+    static auto checked(const result& result) -> const CassResult*
+    {
+        if (result.m_cass_result_ptr == nullptr)
+        {
+            throw std::runtime_error("priam::arrow: the result failed with " + to_string(result.status()) + ".");
+        }
+        return result.m_cass_result_ptr.get();
+    }
+};
+
+namespace
+{
+/**
+ * The state of an exported ArrowArrayStream.
+ */
+struct stream_private
+{
+    /// Fetches the next result.
+    std::function<std::optional<result>()> next_result{};
+    /// The first result, fetched up front for the schema.
+    std::optional<result> first{};
+    /// The layout every result must have.
+    schema_node schema{};
+    /// The message of the last failed call.
+    std::string last_error{};
+};
+
+auto stream_get_schema(ArrowArrayStream* stream, ArrowSchema* out) -> int
+{
+    auto* data = static_cast<stream_private*>(stream->private_data);
+    try
+    {
+        export_schema(data->schema, out);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        data->last_error = e.what();
+        return ENOMEM;
+    }
+}
+
+auto stream_get_next(ArrowArrayStream* stream, ArrowArray* out) -> int
+{
+    auto* data = static_cast<stream_private*>(stream->private_data);
+    try
+    {
+        auto next = data->first.has_value() ? std::exchange(data->first, std::nullopt) : data->next_result();
+        if (!next.has_value())
+        {
+            // A released array marks the end of the stream.
+            out->release = nullptr;
+            return 0;
+        }
+
+        if (!same_layout(arrow_exporter::schema(next.value()), data->schema))
+        {
+            throw std::runtime_error("priam::arrow: a result's columns differ from the stream's schema.");
+        }
+        arrow_exporter::array(next.value(), out);
+        return 0;
+    }
+    catch (const std::exception& e)
+    {
+        data->last_error = e.what();
+        return EIO;
+    }
+}
+
+auto stream_get_last_error(ArrowArrayStream* stream) -> const char*
+{
+    auto* data = static_cast<stream_private*>(stream->private_data);
+    return data->last_error.empty() ? nullptr : data->last_error.c_str();
+}
+
+auto stream_release(ArrowArrayStream* stream) -> void
+{
+    delete static_cast<stream_private*>(stream->private_data);
+    stream->release = nullptr;
+}
+
+} // namespace
+
+auto to_arrow_format(data_type type) -> std::string_view
+{
+    switch (type)
+    {
+        case data_type::ascii:
+        case data_type::text:
+        case data_type::varchar:
+            return "u";
+        case data_type::tinyint:
+            return "c";
+        case data_type::smallint:
+            return "s";
+        case data_type::int_t:
+            return "i";
+        case data_type::bigint:
+        case data_type::counter:
+            return "l";
+        case data_type::float_t:
+            return "f";
+        case data_type::double_t:
+            return "g";
+        case data_type::boolean:
+            return "b";
+        case data_type::timestamp:
+            return "tsm:UTC";
+        case data_type::date:
+            return "tdD";
+        case data_type::time:
+            return "ttn";
+        case data_type::duration:
+            return "tin";
+        case data_type::uuid:
+        case data_type::timeuuid:
+            return "w:16";
+        case data_type::list:
+        case data_type::set:
+            return "+l";
+        case data_type::map:
+            return "+m";
+        case data_type::tuple:
+        case data_type::udt:
+            return "+s";
+        case data_type::blob:
+        case data_type::inet:
+        case data_type::varint:
+        case data_type::decimal:
+        case data_type::custom:
+        case data_type::unknown:
+            return "z";
+    }
+    return "z";
+}
+
+auto arrow_export_schema(const result& result, ArrowSchema* out) -> void
+{
+    export_schema(arrow_exporter::schema(result), out);
+}
+
+auto arrow_export_array(const result& result, ArrowArray* out) -> void
+{
+    arrow_exporter::array(result, out);
+}
+
+auto arrow_export_stream(std::function<std::optional<result>()> next_result, ArrowArrayStream* out) -> void
+{
+    auto data         = std::make_unique<stream_private>();
+    data->next_result = std::move(next_result);
+    data->first       = data->next_result();
+    if (!data->first.has_value())
+    {
+        throw std::runtime_error("priam::arrow: the stream has no results.");
+    }
+    data->schema = arrow_exporter::schema(data->first.value());
+
+    out->get_schema     = stream_get_schema;
+    out->get_next       = stream_get_next;
+    out->get_last_error = stream_get_last_error;
+    out->release        = stream_release;
+    out->private_data   = data.release();
+}
+
+} // namespace priam
@@ -0,0 +1,202 @@
+#include "priam/auto_prepare_cache.hpp"
+#include "priam/prepared.hpp"
+
+#include <utility>
+
+namespace priam
+{
+/**
+ * @return The number of enabled caches in the process, statements only intern their text while it is not 0.
+ */
+static auto enabled_caches() -> std::atomic<size_t>&
+{
+    static std::atomic<size_t> enabled{0};
+    return enabled;
+}
+
+/**
+ * The interned text of ad-hoc statements.  Entries are weak so the text is released with the last statement.
+ */
+struct interned_queries
+{
+    std::mutex                                                              m_mutex{};
+    std::unordered_map<std::string_view, std::weak_ptr<const std::string>> m_queries{};
+};
+
+static auto queries() -> interned_queries&
+{
+    // Never destroyed so statements destroyed during static destruction can still release their text.
+    static auto* queries = new interned_queries{};
+    return *queries;
+}
+
+/**
+ * Deleter for interned text, removes its entry unless the text was already interned again.
+ * @param query The interned text.
+ */
+static auto release_query(const std::string* query) -> void
+{
+    auto& interned = queries();
+    {
+        std::lock_guard<std::mutex> guard{interned.m_mutex};
+        auto                        found = interned.m_queries.find(*query);
+        if (found != interned.m_queries.end() && found->first.data() == query->data())
+        {
+            interned.m_queries.erase(found);
+        }
+    }
+    delete query;
+}
+
+auto_prepare_cache::~auto_prepare_cache()
+{
+    if (enabled())
+    {
+        enabled_caches().fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+auto auto_prepare_cache::configure(size_t capacity, uint32_t hit_threshold) -> void
+{
+    std::lock_guard<std::mutex> guard{m_mutex};
+    m_hit_threshold = (hit_threshold == 0) ? 1 : hit_threshold;
+    if (enabled() != (capacity != 0))
+    {
+        if (capacity != 0)
+        {
+            enabled_caches().fetch_add(1, std::memory_order_relaxed);
+        }
+        else
+        {
+            enabled_caches().fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+    m_capacity.store(capacity, std::memory_order_relaxed);
+    evict(capacity);
+}
+
+auto auto_prepare_cache::hit(CassSession* session, std::string_view query) -> std::shared_ptr<prepared>
+{
+    std::unique_ptr<prepare_data> data{nullptr};
+    {
+        std::lock_guard<std::mutex> guard{m_mutex};
+        auto                        capacity = m_capacity.load(std::memory_order_relaxed);
+        if (capacity == 0)
+        {
+            return {nullptr};
+        }
+
+        auto found = m_index.find(query);
+        if (found == m_index.end())
+        {
+            evict(capacity - 1);
+            m_lru.push_front(entry{std::string{query}, 0, false, nullptr});
+            found = m_index.emplace(m_lru.front().m_query, m_lru.begin()).first;
+        }
+        else
+        {
+            m_lru.splice(m_lru.begin(), m_lru, found->second);
+        }
+
+        auto& e = *found->second;
+        if (e.m_prepared_ptr != nullptr)
+        {
+            return e.m_prepared_ptr;
+        }
+
+        if (++e.m_hits < m_hit_threshold || e.m_preparing)
+        {
+            return {nullptr};
+        }
+
+        e.m_preparing = true;
+        data          = std::make_unique<prepare_data>(prepare_data{*this, e.m_query});
+    }
+
+    // Issued outside the lock, the driver invokes the callback inline if the future has already completed.
+    auto prepare_future =
+        cass_future_ptr(cass_session_prepare_n(session, data->m_query.data(), data->m_query.length()));
+    cass_future_set_callback(prepare_future.get(), on_prepared, data.release());
+    return {nullptr};
+}
+
+auto auto_prepare_cache::find(std::string_view query) const -> std::shared_ptr<prepared>
+{
+    std::lock_guard<std::mutex> guard{m_mutex};
+    auto                        found = m_index.find(query);
+    return (found != m_index.end()) ? found->second->m_prepared_ptr : nullptr;
+}
+
+auto auto_prepare_cache::size() const -> size_t
+{
+    std::lock_guard<std::mutex> guard{m_mutex};
+    return m_lru.size();
+}
+
+auto auto_prepare_cache::intern(std::string_view query) -> std::shared_ptr<const std::string>
+{
+    if (enabled_caches().load(std::memory_order_relaxed) == 0)
+    {
+        return {nullptr};
+    }
+
+    auto&                       interned = queries();
+    std::lock_guard<std::mutex> guard{interned.m_mutex};
+    auto                        found = interned.m_queries.find(query);
+    if (found != interned.m_queries.end())
+    {
+        if (auto text = found->second.lock(); text != nullptr)
+        {
+            return text;
+        }
+        // The last statement with this text is being destroyed, its deleter skips the replaced entry.
+        interned.m_queries.erase(found);
+    }
+
+    auto text = std::shared_ptr<const std::string>(new std::string{query}, release_query);
+    interned.m_queries.emplace(*text, text);
+    return text;
+}
+
+auto auto_prepare_cache::evict(size_t capacity) -> void
+{
+    while (m_lru.size() > capacity)
+    {
+        m_index.erase(m_lru.back().m_query);
+        m_lru.pop_back();
+    }
+}
+
+auto auto_prepare_cache::on_prepared(CassFuture* prepare_future, void* data) -> void
+{
+    auto  data_ptr = std::unique_ptr<prepare_data>(static_cast<prepare_data*>(data));
+    auto& cache    = data_ptr->m_cache;
+
+    std::shared_ptr<prepared> prepared_ptr{nullptr};
+    if (cass_future_error_code(prepare_future) == CASS_OK)
+    {
+        // Using new shared_ptr as Prepared's constructor is private but friended to the cache.
+        prepared_ptr = std::shared_ptr<prepared>(
+            new prepared(cass_prepared_ptr(cass_future_get_prepared(prepare_future)), data_ptr->m_query));
+    }
+
+    std::lock_guard<std::mutex> guard{cache.m_mutex};
+    auto                        found = cache.m_index.find(data_ptr->m_query);
+    // The query might have been evicted while it was being prepared.
+    if (found != cache.m_index.end())
+    {
+        auto& e = *found->second;
+        if (prepared_ptr != nullptr)
+        {
+            e.m_prepared_ptr = std::move(prepared_ptr);
+        }
+        else
+        {
+            // Failed to prepare, count the query again from the start so it can be retried.
+            e.m_hits      = 0;
+            e.m_preparing = false;
+        }
+    }
+}
+
+} // namespace priam
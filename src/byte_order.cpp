@@ -0,0 +1,196 @@
+#include "priam/byte_order.hpp"
+
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define PRIAM_BYTE_ORDER_X86 1
+#elif defined(__aarch64__)
+    #include <arm_neon.h>
+    #define PRIAM_BYTE_ORDER_NEON 1
+#endif
+
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    #define PRIAM_BYTE_ORDER_BIG_ENDIAN 1
+#endif
+
+namespace priam
+{
+namespace
+{
+auto byte_swap(uint16_t value) -> uint16_t
+{
+    return __builtin_bswap16(value);
+}
+
+auto byte_swap(uint32_t value) -> uint32_t
+{
+    return __builtin_bswap32(value);
+}
+
+auto byte_swap(uint64_t value) -> uint64_t
+{
+    return __builtin_bswap64(value);
+}
+
+/**
+ * @param lane_byte The byte's position in a 16 byte lane.
+ * @param width The width of each value in bytes.
+ * @return The position the byte is shuffled from to reverse each value.
+ */
+constexpr auto shuffle_index(size_t lane_byte, size_t width) -> char
+{
+    return static_cast<char>((lane_byte / width) * width + (width - 1 - lane_byte % width));
+}
+
+#if defined(PRIAM_BYTE_ORDER_X86)
+
+/**
+ * Byte swaps whole 32 byte blocks.
+ * @return The number of bytes swapped.
+ */
+__attribute__((target("avx2"))) auto swap_avx2(uint8_t* data, size_t bytes, size_t width) -> size_t
+{
+    // The shuffle is within each 128 bit lane so both lanes use the same pattern.
+    const __m256i mask = _mm256_setr_epi8(
+        shuffle_index(0, width),  shuffle_index(1, width),  shuffle_index(2, width),  shuffle_index(3, width),
+        shuffle_index(4, width),  shuffle_index(5, width),  shuffle_index(6, width),  shuffle_index(7, width),
+        shuffle_index(8, width),  shuffle_index(9, width),  shuffle_index(10, width), shuffle_index(11, width),
+        shuffle_index(12, width), shuffle_index(13, width), shuffle_index(14, width), shuffle_index(15, width),
+        shuffle_index(0, width),  shuffle_index(1, width),  shuffle_index(2, width),  shuffle_index(3, width),
+        shuffle_index(4, width),  shuffle_index(5, width),  shuffle_index(6, width),  shuffle_index(7, width),
+        shuffle_index(8, width),  shuffle_index(9, width),  shuffle_index(10, width), shuffle_index(11, width),
+        shuffle_index(12, width), shuffle_index(13, width), shuffle_index(14, width), shuffle_index(15, width));
+
+    size_t i{0};
+    for (; i + sizeof(__m256i) <= bytes; i += sizeof(__m256i))
+    {
+        auto* block = reinterpret_cast<__m256i*>(data + i);
+        _mm256_storeu_si256(block, _mm256_shuffle_epi8(_mm256_loadu_si256(block), mask));
+    }
+    return i;
+}
+
+/**
+ * Byte swaps whole 16 byte blocks.
+ * @return The number of bytes swapped.
+ */
+__attribute__((target("ssse3"))) auto swap_ssse3(uint8_t* data, size_t bytes, size_t width) -> size_t
+{
+    const __m128i mask = _mm_setr_epi8(
+        shuffle_index(0, width),  shuffle_index(1, width),  shuffle_index(2, width),  shuffle_index(3, width),
+        shuffle_index(4, width),  shuffle_index(5, width),  shuffle_index(6, width),  shuffle_index(7, width),
+        shuffle_index(8, width),  shuffle_index(9, width),  shuffle_index(10, width), shuffle_index(11, width),
+        shuffle_index(12, width), shuffle_index(13, width), shuffle_index(14, width), shuffle_index(15, width));
+
+    size_t i{0};
+    for (; i + sizeof(__m128i) <= bytes; i += sizeof(__m128i))
+    {
+        auto* block = reinterpret_cast<__m128i*>(data + i);
+        _mm_storeu_si128(block, _mm_shuffle_epi8(_mm_loadu_si128(block), mask));
+    }
+    return i;
+}
+
+auto swap_simd(uint8_t* data, size_t bytes, size_t width) -> size_t
+{
+    static const bool has_avx2  = (__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+    static const bool has_ssse3 = __builtin_cpu_supports("ssse3");
+
+    if (has_avx2)
+    {
+        return swap_avx2(data, bytes, width);
+    }
+    if (has_ssse3)
+    {
+        return swap_ssse3(data, bytes, width);
+    }
+    return 0;
+}
+
+#elif defined(PRIAM_BYTE_ORDER_NEON)
+
+auto swap_simd(uint8_t* data, size_t bytes, size_t width) -> size_t
+{
+    size_t i{0};
+    for (; i + sizeof(uint8x16_t) <= bytes; i += sizeof(uint8x16_t))
+    {
+        auto block = vld1q_u8(data + i);
+        switch (width)
+        {
+            case 2:
+                block = vrev16q_u8(block);
+                break;
+            case 4:
+                block = vrev32q_u8(block);
+                break;
+            default:
+                block = vrev64q_u8(block);
+                break;
+        }
+        vst1q_u8(data + i, block);
+    }
+    return i;
+}
+
+#else
+
+auto swap_simd(uint8_t*, size_t, size_t) -> size_t
+{
+    return 0;
+}
+
+#endif
+
+/**
+ * @tparam value_type The type of each value.
+ * @tparam bits_type The unsigned integer of the same width, floating point values are swapped through a copy
+ *                   of their bits.
+ */
+template<typename value_type, typename bits_type>
+auto swap(value_type* data, size_t count) -> void
+{
+    static_assert(sizeof(value_type) == sizeof(bits_type));
+#if defined(PRIAM_BYTE_ORDER_BIG_ENDIAN)
+    (void)data;
+    (void)count;
+#else
+    auto swapped = swap_simd(reinterpret_cast<uint8_t*>(data), count * sizeof(value_type), sizeof(value_type));
+    for (size_t i = swapped / sizeof(value_type); i < count; ++i)
+    {
+        bits_type bits{};
+        std::memcpy(&bits, &data[i], sizeof(bits));
+        bits = byte_swap(bits);
+        std::memcpy(&data[i], &bits, sizeof(bits));
+    }
+#endif
+}
+
+} // namespace
+
+auto big_endian_to_host(uint16_t* data, size_t count) -> void
+{
+    swap<uint16_t, uint16_t>(data, count);
+}
+
+auto big_endian_to_host(uint32_t* data, size_t count) -> void
+{
+    swap<uint32_t, uint32_t>(data, count);
+}
+
+auto big_endian_to_host(uint64_t* data, size_t count) -> void
+{
+    swap<uint64_t, uint64_t>(data, count);
+}
+
+auto big_endian_to_host(float* data, size_t count) -> void
+{
+    swap<float, uint32_t>(data, count);
+}
+
+auto big_endian_to_host(double* data, size_t count) -> void
+{
+    swap<double, uint64_t>(data, count);
+}
+
+} // namespace priam
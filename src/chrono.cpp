@@ -0,0 +1,100 @@
+#include "priam/chrono.hpp"
+
+namespace priam
+{
+namespace
+{
+constexpr int64_t millis_per_day = 86'400'000;
+
+/**
+ * Writes 'value' as exactly 'width' digits, zero padded.
+ */
+auto write_digits(char* out, uint64_t value, size_t width) -> char*
+{
+    for (size_t i = width; i > 0; --i)
+    {
+        out[i - 1] = static_cast<char>('0' + value % 10);
+        value /= 10;
+    }
+    return out + width;
+}
+
+/**
+ * Converts days since the unix epoch into a proleptic Gregorian year, month and day.
+ * @see http://howardhinnant.github.io/date_algorithms.html#civil_from_days
+ */
+auto civil_from_days(int64_t days, int64_t& year, uint32_t& month, uint32_t& day) -> void
+{
+    days += 719468;
+    const int64_t  era = (days >= 0 ? days : days - 146096) / 146097;
+    const uint32_t doe = static_cast<uint32_t>(days - era * 146097);
+    const uint32_t yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+    const uint32_t doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+    const uint32_t mp  = (5 * doy + 2) / 153;
+
+    day   = doy - (153 * mp + 2) / 5 + 1;
+    month = mp < 10 ? mp + 3 : mp - 9;
+    year  = static_cast<int64_t>(yoe) + era * 400 + (month <= 2 ? 1 : 0);
+}
+
+} // namespace
+
+auto to_iso8601(char* first, timestamp value) -> char*
+{
+    auto millis = static_cast<int64_t>(value.time_since_epoch().count());
+    auto days   = millis / millis_per_day;
+    auto remain = millis % millis_per_day;
+    // Floor so times before the epoch fall on the previous day.
+    if (remain < 0)
+    {
+        remain += millis_per_day;
+        --days;
+    }
+    auto millis_of_day = static_cast<uint64_t>(remain);
+
+    int64_t  year{0};
+    uint32_t month{0};
+    uint32_t day{0};
+    civil_from_days(days, year, month, day);
+
+    auto* out = first;
+    if (year >= 0 && year <= 9999)
+    {
+        out = write_digits(out, static_cast<uint64_t>(year), 4);
+    }
+    else
+    {
+        *out++ = (year < 0) ? '-' : '+';
+
+        auto   magnitude = (year < 0) ? static_cast<uint64_t>(-year) : static_cast<uint64_t>(year);
+        size_t width{0};
+        for (auto remaining = magnitude; remaining > 0; remaining /= 10)
+        {
+            ++width;
+        }
+        out = write_digits(out, magnitude, (width < 4) ? 4 : width);
+    }
+
+    *out++ = '-';
+    out    = write_digits(out, month, 2);
+    *out++ = '-';
+    out    = write_digits(out, day, 2);
+    *out++ = 'T';
+    out    = write_digits(out, millis_of_day / 3'600'000, 2);
+    *out++ = ':';
+    out    = write_digits(out, (millis_of_day / 60'000) % 60, 2);
+    *out++ = ':';
+    out    = write_digits(out, (millis_of_day / 1'000) % 60, 2);
+    *out++ = '.';
+    out    = write_digits(out, millis_of_day % 1'000, 3);
+    *out++ = 'Z';
+    return out;
+}
+
+auto to_iso8601(timestamp value) -> std::string
+{
+    char buffer[iso8601_max_length];
+    return std::string(buffer, to_iso8601(buffer, value));
+}
+
+} // namespace priam
@@ -1,7 +1,10 @@
 #include "priam/client.hpp"
 #include "priam/prepared.hpp"
+#include "priam/prepared_manifest.hpp"
 #include "priam/result.hpp"
+#include "priam/statement.hpp"
 
+#include <optional>
 #include <stdexcept>
 #include <utility>
 
@@ -70,34 +73,147 @@ auto client::prepared_register(std::string name, std::string_view query) -> std:
 {
     // Using new shared_ptr as Prepared's constructor is private but friended to Client.
     auto prepared_ptr = std::shared_ptr<prepared>(new prepared(*this, query));
-    m_prepared_statements.emplace(std::move(name), prepared_ptr);
+    m_prepared_statements.insert(std::move(name), prepared_ptr);
     return prepared_ptr;
 }
 
+auto client::prepared_register_all(const std::vector<prepared_definition>& definitions)
+    -> std::vector<prepared_register_result>
+{
+    // Issue every prepare before waiting on any of them so they are all in flight together.
+    std::vector<cass_future_ptr> prepare_futures{};
+    prepare_futures.reserve(definitions.size());
+    for (const auto& definition : definitions)
+    {
+        prepare_futures.emplace_back(cass_session_prepare_n(
+            m_cass_session_ptr.get(), definition.query.data(), definition.query.length()));
+    }
+
+    std::vector<prepared_register_result> results{};
+    results.reserve(definitions.size());
+    for (size_t i = 0; i < definitions.size(); ++i)
+    {
+        const auto& definition = definitions[i];
+        auto*       future     = prepare_futures[i].get();
+
+        CassError rc = cass_future_error_code(future);
+        if (rc == CASS_OK)
+        {
+            // Using new shared_ptr as Prepared's constructor is private but friended to Client.
+            auto prepared_ptr = std::shared_ptr<prepared>(
+                new prepared(cass_prepared_ptr(cass_future_get_prepared(future)), definition.query));
+            m_prepared_statements.insert(definition.name, prepared_ptr);
+            if (prepared_ptr->handle().valid())
+            {
+                results.push_back(
+                    prepared_register_result{definition.name, std::move(prepared_ptr), status::ok, {}});
+            }
+            else
+            {
+                // The name keeps referring to the prepared statement it was first registered as.
+                results.push_back(prepared_register_result{
+                    definition.name, nullptr, status::client_bad_params, "Name is already registered."});
+            }
+        }
+        else
+        {
+            const char* message;
+            size_t      message_length;
+            cass_future_error_message(future, &message, &message_length);
+
+            results.push_back(prepared_register_result{
+                definition.name, nullptr, static_cast<priam::status>(rc), std::string{message, message_length}});
+        }
+    }
+
+    return results;
+}
+
+auto client::prepared_manifest() const -> std::vector<prepared_definition>
+{
+    return m_prepared_statements.definitions();
+}
+
+auto client::prepared_manifest_save(const std::string& path) const -> void
+{
+    prepared_manifest_write(path, prepared_manifest());
+}
+
+auto client::prepared_manifest_load(const std::string& path) -> std::vector<prepared_register_result>
+{
+    return prepared_register_all(prepared_manifest_read(path));
+}
+
 auto client::prepared_lookup(const std::string& name) -> std::shared_ptr<prepared>
 {
-    auto exists = m_prepared_statements.find(name);
-    if (exists != m_prepared_statements.end())
+    auto* prepared_ptr = m_prepared_statements.get(m_prepared_statements.find(name));
+    if (prepared_ptr != nullptr)
     {
-        return exists->second;
+        return prepared_ptr->shared_from_this();
     }
     return {nullptr};
 }
 
+auto client::prepared_find(std::string_view name) const -> prepared_handle
+{
+    return m_prepared_statements.find(name);
+}
+
+auto client::auto_prepare(size_t capacity, uint32_t hit_threshold) -> void
+{
+    m_auto_prepare.configure(capacity, hit_threshold);
+}
+
+auto client::auto_prepared(std::string_view query) const -> std::shared_ptr<prepared>
+{
+    return m_auto_prepare.find(query);
+}
+
+auto client::make_statement(std::string_view query) const -> statement
+{
+    if (m_auto_prepare.enabled())
+    {
+        auto prepared_ptr = m_auto_prepare.find(query);
+        if (prepared_ptr != nullptr)
+        {
+            return prepared_ptr->make_statement();
+        }
+    }
+    return statement{query};
+}
+
+auto client::auto_prepare_statement(const statement& statement) -> cass_statement_ptr
+{
+    if (!m_auto_prepare.enabled() || statement.m_query == nullptr)
+    {
+        return {nullptr};
+    }
+
+    auto prepared_ptr = m_auto_prepare.hit(m_cass_session_ptr.get(), *statement.m_query);
+    if (prepared_ptr == nullptr || statement.m_parameter_count != 0)
+    {
+        return {nullptr};
+    }
+    return cass_statement_ptr(cass_prepared_bind(prepared_ptr->m_cass_prepared_ptr.get()));
+}
+
 auto client::execute_statement(const statement& statement, std::chrono::milliseconds timeout, consistency c)
     -> priam::result
 {
     m_active_requests.fetch_add(1, std::memory_order_relaxed);
 
-    cass_statement_set_consistency(statement.m_cass_statement_ptr.get(), static_cast<CassConsistency>(c));
+    auto  auto_prepared_ptr = auto_prepare_statement(statement);
+    auto* cass_statement =
+        (auto_prepared_ptr != nullptr) ? auto_prepared_ptr.get() : statement.m_cass_statement_ptr.get();
+
+    cass_statement_set_consistency(cass_statement, static_cast<CassConsistency>(c));
     if (timeout != 0ms)
     {
         // not really sure if this works on synchronous queries, but it can't hurt?
-        cass_statement_set_request_timeout(
-            statement.m_cass_statement_ptr.get(), static_cast<cass_uint64_t>(timeout.count()));
+        cass_statement_set_request_timeout(cass_statement, static_cast<cass_uint64_t>(timeout.count()));
     }
 
-    CassFuture* query_future = cass_session_execute(m_cass_session_ptr.get(), statement.m_cass_statement_ptr.get());
+    CassFuture* query_future = cass_session_execute(m_cass_session_ptr.get(), cass_statement);
 
     if (timeout != 0ms)
     {
@@ -112,6 +228,12 @@ auto client::execute_statement(const statement& statement, std::chrono::millisec
         cass_future_wait(query_future);
     }
 
+    // A timed out request is still in flight, the driver may retry or re-send the statement.
+    if (!cass_future_ready(query_future))
+    {
+        statement.m_recyclable.store(false, std::memory_order_relaxed);
+    }
+
     // This will block until there is a response or a timeout.
     auto r = priam::result(query_future);
     m_active_requests.fetch_sub(1, std::memory_order_relaxed);
@@ -127,6 +249,8 @@ struct callback_data
 
     client& m_client;
     std::function<void(result)> m_on_complete_callback{nullptr};
+    /// Statements moved into execute_statement() are owned until the request completes.
+    std::optional<statement> m_statement{};
 };
 
 auto client::execute_statement(
@@ -135,15 +259,40 @@ auto client::execute_statement(
     std::chrono::milliseconds   timeout,
     consistency                 c) -> void
 {
-    m_active_requests.fetch_add(1, std::memory_order_relaxed);
+    // The caller can destroy the statement before the request completes, only owned statements are pooled again.
+    statement.m_recyclable.store(false, std::memory_order_relaxed);
+    execute_async(statement, std::make_unique<callback_data>(*this, std::move(on_complete_callback)), timeout, c);
+}
+
+auto client::execute_statement(
+    statement&&                 statement,
+    std::function<void(result)> on_complete_callback,
+    std::chrono::milliseconds   timeout,
+    consistency                 c) -> void
+{
     auto callback_ptr = std::make_unique<callback_data>(*this, std::move(on_complete_callback));
+    auto& owned       = callback_ptr->m_statement.emplace(std::move(statement));
+    execute_async(owned, std::move(callback_ptr), timeout, c);
+}
+
+auto client::execute_async(
+    const statement&               statement,
+    std::unique_ptr<callback_data> callback_ptr,
+    std::chrono::milliseconds      timeout,
+    consistency                    c) -> void
+{
+    m_active_requests.fetch_add(1, std::memory_order_relaxed);
+
+    // The driver retains its own reference to the statement, so the auto prepared one can be freed on return.
+    auto  auto_prepared_ptr = auto_prepare_statement(statement);
+    auto* cass_statement =
+        (auto_prepared_ptr != nullptr) ? auto_prepared_ptr.get() : statement.m_cass_statement_ptr.get();
 
-    cass_statement_set_consistency(statement.m_cass_statement_ptr.get(), static_cast<CassConsistency>(c));
+    cass_statement_set_consistency(cass_statement, static_cast<CassConsistency>(c));
 
     if (timeout != 0ms)
     {
-        cass_statement_set_request_timeout(
-            statement.m_cass_statement_ptr.get(), static_cast<cass_uint64_t>(timeout.count()));
+        cass_statement_set_request_timeout(cass_statement, static_cast<cass_uint64_t>(timeout.count()));
     }
 
     /**
@@ -154,7 +303,7 @@ auto client::execute_statement(
      * Note that the underlying driver also retains a reference count to the query future and
      * deletes its reference after the internal_on_complete_callback is completed.
      */
-    CassFuture* query_future = cass_session_execute(m_cass_session_ptr.get(), statement.m_cass_statement_ptr.get());
+    CassFuture* query_future = cass_session_execute(m_cass_session_ptr.get(), cass_statement);
 
     cass_future_set_callback(query_future, internal_on_complete_callback, callback_ptr.release());
 }
@@ -109,6 +109,28 @@ auto cluster::speculative_execution(
     return false;
 }
 
+auto cluster::prepare_on_all_hosts(bool enabled) -> bool
+{
+    if (m_cass_cluster_ptr != nullptr)
+    {
+        CassError error =
+            cass_cluster_set_prepare_on_all_hosts(m_cass_cluster_ptr.get(), static_cast<cass_bool_t>(enabled));
+        return (error == CassError::CASS_OK);
+    }
+    return false;
+}
+
+auto cluster::prepare_on_up_or_add_host(bool enabled) -> bool
+{
+    if (m_cass_cluster_ptr != nullptr)
+    {
+        CassError error =
+            cass_cluster_set_prepare_on_up_or_add_host(m_cass_cluster_ptr.get(), static_cast<cass_bool_t>(enabled));
+        return (error == CassError::CASS_OK);
+    }
+    return false;
+}
+
 auto cluster::heartbeat_interval(std::chrono::seconds interval, std::chrono::seconds idle_timeout) -> bool
 {
     if (m_cass_cluster_ptr != nullptr)
@@ -127,6 +149,10 @@ cluster::cluster() : m_cass_cluster_ptr(cass_cluster_new())
     {
         throw std::runtime_error("Client: Failed to initialize cassandra cluster.");
     }
+
+    // Always warm registered prepared statements on every host, including hosts that restart.
+    prepare_on_all_hosts(true);
+    prepare_on_up_or_add_host(true);
 }
 
 static auto hosts_to_csv(const std::set<std::string>& hosts) -> std::string
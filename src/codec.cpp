@@ -0,0 +1,208 @@
+#include "priam/codec.hpp"
+#include "priam/byte_order.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace priam
+{
+namespace
+{
+constexpr size_t length_size = sizeof(int32_t);
+
+/// The most user defined type layouts cached per mapped struct and thread.
+constexpr size_t user_type_layout_cache_size = 16;
+
+auto read_length(const cass_byte_t* bytes) -> int32_t
+{
+    uint32_t length{0};
+    std::memcpy(&length, bytes, sizeof(length));
+    big_endian_to_host(&length, 1);
+    return static_cast<int32_t>(length);
+}
+
+auto to_host(void* output, size_t width, size_t count) -> void
+{
+    switch (width)
+    {
+        case sizeof(uint16_t):
+            big_endian_to_host(static_cast<uint16_t*>(output), count);
+            break;
+        case sizeof(uint32_t):
+            big_endian_to_host(static_cast<uint32_t*>(output), count);
+            break;
+        case sizeof(uint64_t):
+            big_endian_to_host(static_cast<uint64_t*>(output), count);
+            break;
+        default:
+            break;
+    }
+}
+
+/**
+ * Appends a description of a data type and all of its sub types, equal descriptions are equal data types.
+ * Names are length prefixed so they cannot be confused with the surrounding description.
+ * @param signature The description to append to.
+ * @param cass_data_type The data type to describe.
+ */
+auto append_type_signature(std::string& signature, const CassDataType* cass_data_type) -> void
+{
+    auto type = to_data_type(cass_data_type);
+    signature += std::to_string(static_cast<int>(type));
+    if (type == data_type::udt)
+    {
+        const char* type_name{nullptr};
+        size_t      type_name_length{0};
+        cass_data_type_type_name(cass_data_type, &type_name, &type_name_length);
+        signature += ':' + std::to_string(type_name_length) + ':';
+        signature.append(type_name, type_name_length);
+    }
+
+    auto sub_type_count = (cass_data_type != nullptr) ? cass_data_type_sub_type_count(cass_data_type) : 0;
+    if (sub_type_count == 0)
+    {
+        return;
+    }
+
+    signature += '<';
+    for (size_t sub_type = 0; sub_type < sub_type_count; ++sub_type)
+    {
+        // User defined type fields are named, collection and tuple sub types are not.
+        const char* name{nullptr};
+        size_t      name_length{0};
+        if (type == data_type::udt &&
+            cass_data_type_sub_type_name(cass_data_type, sub_type, &name, &name_length) == CASS_OK)
+        {
+            signature += std::to_string(name_length) + ':';
+            signature.append(name, name_length);
+        }
+        append_type_signature(signature, cass_data_type_sub_data_type(cass_data_type, sub_type));
+        signature += ',';
+    }
+    signature += '>';
+}
+} // namespace
+
+auto decode_fixed_width_collection(
+    const CassValue* cass_value, void* const* outputs, const size_t* widths, size_t items_per_entry, size_t count)
+    -> bool
+{
+    ptr<const cass_byte_t> bytes{nullptr};
+    size_t                 bytes_size{0};
+    if (cass_value_get_bytes(cass_value, &bytes, &bytes_size) != CASS_OK)
+    {
+        return false;
+    }
+
+    size_t entry_size{0};
+    for (size_t item = 0; item < items_per_entry; ++item)
+    {
+        entry_size += length_size + widths[item];
+    }
+
+    // Each item is a 4 byte length and its bytes, the driver's bytes start after the collection's item count but
+    // allow for the count being included.
+    if (bytes_size == length_size + entry_size * count && read_length(bytes) == static_cast<int32_t>(count))
+    {
+        bytes += length_size;
+        bytes_size -= length_size;
+    }
+    if (bytes_size != entry_size * count)
+    {
+        return false;
+    }
+
+    for (size_t entry = 0; entry < count; ++entry)
+    {
+        for (size_t item = 0; item < items_per_entry; ++item)
+        {
+            auto width = widths[item];
+            if (read_length(bytes) != static_cast<int32_t>(width))
+            {
+                return false;
+            }
+            std::memcpy(static_cast<std::byte*>(outputs[item]) + entry * width, bytes + length_size, width);
+            bytes += length_size + width;
+        }
+    }
+
+    for (size_t item = 0; item < items_per_entry; ++item)
+    {
+        to_host(outputs[item], widths[item], count);
+    }
+    return true;
+}
+
+auto lookup_user_type_layout(
+    std::vector<std::shared_ptr<user_type_layout>>& cache,
+    const CassDataType*                             cass_data_type,
+    const std::string_view*                         names,
+    size_t                                          count) -> std::shared_ptr<user_type_layout>
+{
+    const char* keyspace{nullptr};
+    size_t      keyspace_length{0};
+    cass_data_type_keyspace(cass_data_type, &keyspace, &keyspace_length);
+    const char* type_name{nullptr};
+    size_t      type_name_length{0};
+    cass_data_type_type_name(cass_data_type, &type_name, &type_name_length);
+
+    std::string_view keyspace_view{keyspace, keyspace_length};
+    std::string_view type_name_view{type_name, type_name_length};
+    auto             field_count = cass_data_type_sub_type_count(cass_data_type);
+
+    std::vector<std::string_view> field_names(field_count);
+    std::string                   field_types{};
+    for (size_t field = 0; field < field_count; ++field)
+    {
+        const char* field_name{nullptr};
+        size_t      field_name_length{0};
+        if (cass_data_type_sub_type_name(cass_data_type, field, &field_name, &field_name_length) == CASS_OK)
+        {
+            field_names[field] = std::string_view{field_name, field_name_length};
+        }
+        append_type_signature(field_types, cass_data_type_sub_data_type(cass_data_type, field));
+        field_types += ',';
+    }
+
+    // Data types are freed with their result and their addresses reused, match on the type's definition.
+    for (const auto& layout : cache)
+    {
+        if (layout->m_keyspace == keyspace_view && layout->m_type_name == type_name_view &&
+            layout->m_field_types == field_types &&
+            std::equal(
+                layout->m_field_names.begin(), layout->m_field_names.end(), field_names.begin(), field_names.end()))
+        {
+            return layout;
+        }
+    }
+
+    // Bound the cache for clients that see many versions of the same type.
+    if (cache.size() >= user_type_layout_cache_size)
+    {
+        cache.erase(cache.begin());
+    }
+
+    auto layout         = std::make_shared<user_type_layout>();
+    layout->m_keyspace  = std::string{keyspace_view};
+    layout->m_type_name = std::string{type_name_view};
+    layout->m_field_names.assign(field_names.begin(), field_names.end());
+    layout->m_field_types = std::move(field_types);
+    layout->m_positions.assign(count, user_type_field_missing);
+    layout->m_members.assign(field_count, user_type_field_missing);
+    for (size_t field = 0; field < field_count; ++field)
+    {
+        for (size_t member = 0; member < count; ++member)
+        {
+            if (names[member] == field_names[field] && layout->m_positions[member] == user_type_field_missing)
+            {
+                layout->m_positions[member] = field;
+                layout->m_members[field]    = member;
+                break;
+            }
+        }
+    }
+    cache.push_back(layout);
+    return layout;
+}
+
+} // namespace priam
@@ -0,0 +1,169 @@
+#include "priam/collection.hpp"
+#include "priam/list.hpp"
+#include "priam/map.hpp"
+#include "priam/set.hpp"
+#include "priam/tuple.hpp"
+#include "priam/user_type.hpp"
+#include "priam/uuid.hpp"
+
+namespace priam
+{
+statement_collection::statement_collection(CassCollectionType type, size_t reserve_size)
+    : m_cass_collection_ptr(cass_collection_new(type, reserve_size))
+{
+}
+
+auto statement_collection::append_ascii(std::string_view data) -> bool
+{
+    return cass_collection_append_string_n(m_cass_collection_ptr.get(), data.data(), data.length()) == CASS_OK;
+}
+
+auto statement_collection::append_big_int(int64_t value) -> bool
+{
+    return cass_collection_append_int64(m_cass_collection_ptr.get(), value) == CASS_OK;
+}
+
+auto statement_collection::append_blob(blob blob) -> bool
+{
+    return cass_collection_append_bytes(
+               m_cass_collection_ptr.get(), reinterpret_cast<const cass_byte_t*>(blob.data()), blob.size()) == CASS_OK;
+}
+
+auto statement_collection::append_boolean(bool value) -> bool
+{
+    return cass_collection_append_bool(m_cass_collection_ptr.get(), static_cast<cass_bool_t>(value)) == CASS_OK;
+}
+
+auto statement_collection::append_counter(int64_t value) -> bool
+{
+    return cass_collection_append_int64(m_cass_collection_ptr.get(), value) == CASS_OK;
+}
+
+auto statement_collection::append_decimal(const decimal& value) -> bool
+{
+    const auto& varint = value.varint();
+    return cass_collection_append_decimal(
+               m_cass_collection_ptr.get(),
+               reinterpret_cast<ptr<const cass_byte_t>>(varint.data()),
+               varint.size(),
+               value.scale()) == CASS_OK;
+}
+
+auto statement_collection::append_double(double value) -> bool
+{
+    return cass_collection_append_double(m_cass_collection_ptr.get(), value) == CASS_OK;
+}
+
+auto statement_collection::append_float(float value) -> bool
+{
+    return cass_collection_append_float(m_cass_collection_ptr.get(), value) == CASS_OK;
+}
+
+auto statement_collection::append_int(int32_t value) -> bool
+{
+    return cass_collection_append_int32(m_cass_collection_ptr.get(), value) == CASS_OK;
+}
+
+auto statement_collection::append_text(std::string_view data) -> bool
+{
+    return append_ascii(data);
+}
+
+auto statement_collection::append_timestamp(priam::timestamp timestamp) -> bool
+{
+    // Cassandra timestamps are 64 bit milliseconds since the unix epoch.
+    auto millis = static_cast<cass_int64_t>(timestamp.time_since_epoch().count());
+    return cass_collection_append_int64(m_cass_collection_ptr.get(), millis) == CASS_OK;
+}
+
+auto statement_collection::append_timestamp(std::time_t timestamp) -> bool
+{
+    return append_timestamp(priam::timestamp{std::chrono::seconds{timestamp}});
+}
+
+auto statement_collection::append_uuid(std::string_view uuid) -> bool
+{
+    CassUuid cass_uuid{};
+    if (!from_chars(uuid, cass_uuid))
+    {
+        return false;
+    }
+    return cass_collection_append_uuid(m_cass_collection_ptr.get(), cass_uuid) == CASS_OK;
+}
+
+auto statement_collection::append_varchar(std::string_view data) -> bool
+{
+    return append_ascii(data);
+}
+
+auto statement_collection::append_varint(const varint& value) -> bool
+{
+    return cass_collection_append_bytes(
+               m_cass_collection_ptr.get(), reinterpret_cast<ptr<const cass_byte_t>>(value.data()), value.size()) ==
+           CASS_OK;
+}
+
+auto statement_collection::append_time_uuid(std::string_view timeuuid) -> bool
+{
+    return append_uuid(timeuuid);
+}
+
+auto statement_collection::append_inet(std::string_view inet) -> bool
+{
+    CassInet  cass_inet;
+    CassError rc = cass_inet_from_string_n(inet.data(), inet.length(), &cass_inet);
+    if (rc != CASS_OK)
+    {
+        return false;
+    }
+    return cass_collection_append_inet(m_cass_collection_ptr.get(), cass_inet) == CASS_OK;
+}
+
+auto statement_collection::append_date(uint32_t date) -> bool
+{
+    return cass_collection_append_uint32(m_cass_collection_ptr.get(), date) == CASS_OK;
+}
+
+auto statement_collection::append_time(int64_t time) -> bool
+{
+    return cass_collection_append_int64(m_cass_collection_ptr.get(), time) == CASS_OK;
+}
+
+auto statement_collection::append_tiny_int(int8_t value) -> bool
+{
+    return cass_collection_append_int8(m_cass_collection_ptr.get(), value) == CASS_OK;
+}
+
+auto statement_collection::append_duration(duration duration) -> bool
+{
+    return cass_collection_append_duration(
+               m_cass_collection_ptr.get(), duration.months(), duration.days(), duration.nanos()) == CASS_OK;
+}
+
+auto statement_collection::append_list(statement_list list) -> bool
+{
+    return cass_collection_append_collection(m_cass_collection_ptr.get(), list.m_cass_collection_ptr.get()) == CASS_OK;
+}
+
+auto statement_collection::append_set(statement_set set) -> bool
+{
+    return cass_collection_append_collection(m_cass_collection_ptr.get(), set.m_cass_collection_ptr.get()) == CASS_OK;
+}
+
+auto statement_collection::append_map(statement_map map) -> bool
+{
+    return cass_collection_append_collection(m_cass_collection_ptr.get(), map.m_cass_collection_ptr.get()) == CASS_OK;
+}
+
+auto statement_collection::append_tuple(statement_tuple tuple) -> bool
+{
+    return cass_collection_append_tuple(m_cass_collection_ptr.get(), tuple.m_cass_tuple_ptr.get()) == CASS_OK;
+}
+
+auto statement_collection::append_user_type(statement_user_type user_type) -> bool
+{
+    return cass_collection_append_user_type(m_cass_collection_ptr.get(), user_type.m_cass_user_type_ptr.get()) ==
+           CASS_OK;
+}
+
+} // namespace priam
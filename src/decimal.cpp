@@ -0,0 +1,151 @@
+#include "priam/decimal.hpp"
+
+#include <cmath>
+#include <cstdlib>
+
+namespace priam
+{
+namespace
+{
+/// Every power of 10 that is exact in a double.
+constexpr double exact_powers_of_10[] = {1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+                                         1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+constexpr int32_t max_exact_power = 22;
+
+/// Every integer with a magnitude up to 2^53 is exact in a double.
+constexpr int64_t max_exact_integer = int64_t{1} << 53;
+
+} // namespace
+
+auto decimal::from_string(std::string_view number) -> std::optional<decimal>
+{
+    std::string digits{};
+    digits.reserve(number.length());
+
+    size_t i{0};
+    if (i < number.length() && (number[i] == '-' || number[i] == '+'))
+    {
+        digits.push_back(number[i++]);
+    }
+
+    auto is_digit = [&](size_t index) -> bool {
+        return index < number.length() && number[index] >= '0' && number[index] <= '9';
+    };
+
+    size_t digit_count{0};
+    for (; is_digit(i); ++i, ++digit_count)
+    {
+        digits.push_back(number[i]);
+    }
+
+    int64_t fraction_digits{0};
+    if (i < number.length() && number[i] == '.')
+    {
+        for (++i; is_digit(i); ++i, ++digit_count, ++fraction_digits)
+        {
+            digits.push_back(number[i]);
+        }
+    }
+    if (digit_count == 0)
+    {
+        return std::nullopt;
+    }
+
+    int64_t exponent{0};
+    if (i < number.length() && (number[i] == 'e' || number[i] == 'E'))
+    {
+        ++i;
+        bool negative_exponent = false;
+        if (i < number.length() && (number[i] == '-' || number[i] == '+'))
+        {
+            negative_exponent = number[i++] == '-';
+        }
+        if (!is_digit(i))
+        {
+            return std::nullopt;
+        }
+        for (; is_digit(i); ++i)
+        {
+            exponent = exponent * 10 + (number[i] - '0');
+            if (exponent > INT32_MAX)
+            {
+                return std::nullopt;
+            }
+        }
+        exponent = negative_exponent ? -exponent : exponent;
+    }
+    if (i != number.length())
+    {
+        return std::nullopt;
+    }
+
+    auto scale = fraction_digits - exponent;
+    if (scale < INT32_MIN || scale > INT32_MAX)
+    {
+        return std::nullopt;
+    }
+
+    auto unscaled = priam::varint::from_string(digits);
+    if (!unscaled.has_value())
+    {
+        return std::nullopt;
+    }
+    return decimal{std::move(unscaled).value(), static_cast<int32_t>(scale)};
+}
+
+auto decimal::to_double() const -> double
+{
+    // An exact integer and an exact power of 10 round once, the result is the nearest double.
+    auto unscaled = m_varint.to_int64();
+    if (unscaled.has_value() && std::llabs(unscaled.value()) <= max_exact_integer)
+    {
+        auto value = static_cast<double>(unscaled.value());
+        if (m_scale >= 0 && m_scale <= max_exact_power)
+        {
+            return value / exact_powers_of_10[m_scale];
+        }
+        if (m_scale < 0 && m_scale >= -max_exact_power)
+        {
+            return value * exact_powers_of_10[-m_scale];
+        }
+    }
+
+    auto value = m_varint.to_double();
+    return (m_scale >= 0) ? value / std::pow(10.0, m_scale) : value * std::pow(10.0, -static_cast<double>(m_scale));
+}
+
+auto decimal::to_string() const -> std::string
+{
+    auto digits   = m_varint.to_string();
+    auto negative = m_varint.is_negative();
+    if (negative)
+    {
+        digits.erase(0, 1);
+    }
+
+    if (m_scale <= 0)
+    {
+        if (digits != "0")
+        {
+            digits.append(static_cast<size_t>(-static_cast<int64_t>(m_scale)), '0');
+        }
+    }
+    else
+    {
+        auto scale = static_cast<size_t>(m_scale);
+        if (digits.length() <= scale)
+        {
+            digits.insert(0, scale - digits.length() + 1, '0');
+        }
+        digits.insert(digits.length() - scale, 1, '.');
+    }
+
+    if (negative)
+    {
+        digits.insert(0, 1, '-');
+    }
+    return digits;
+}
+
+} // namespace priam
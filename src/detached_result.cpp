@@ -0,0 +1,623 @@
+#include "priam/detached_result.hpp"
+#include "priam/byte_order.hpp"
+
+#include <cstring>
+#include <new>
+#include <stdexcept>
+#include <utility>
+
+namespace priam
+{
+namespace
+{
+/// Durations are stored decoded, the driver's encoding is variable length.
+struct stored_duration
+{
+    int32_t months;
+    int32_t days;
+    int64_t nanos;
+};
+
+constexpr size_t arena_alignment = alignof(std::max_align_t);
+
+auto align(size_t offset) -> size_t
+{
+    return (offset + alignof(uint64_t) - 1) & ~(alignof(uint64_t) - 1);
+}
+
+/**
+ * @return The width of a column stored fixed width, 0 if its values are stored in the heap.
+ */
+auto fixed_width(data_type type) -> size_t
+{
+    switch (type)
+    {
+        case data_type::boolean:
+        case data_type::tinyint:
+            return 1;
+        case data_type::smallint:
+            return 2;
+        case data_type::int_t:
+        case data_type::date:
+        case data_type::float_t:
+            return 4;
+        case data_type::bigint:
+        case data_type::counter:
+        case data_type::time:
+        case data_type::timestamp:
+        case data_type::double_t:
+            return 8;
+        case data_type::uuid:
+        case data_type::timeuuid:
+            return sizeof(CassUuid);
+        case data_type::inet:
+            return sizeof(CassInet);
+        case data_type::duration:
+            return sizeof(stored_duration);
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @return True if the column's values are copied as network order bytes and converted in bulk.
+ */
+auto is_network_order(data_type type) -> bool
+{
+    switch (type)
+    {
+        case data_type::uuid:
+        case data_type::timeuuid:
+        case data_type::inet:
+        case data_type::duration:
+            return false;
+        default:
+            return fixed_width(type) != 0;
+    }
+}
+
+/**
+ * Copies a non-null fixed width value into 'output', values the driver decodes are stored in host order,
+ * the rest are left in network order.
+ * @return True if the value was copied.
+ */
+auto copy_fixed(const CassValue* cass_value, data_type type, size_t width, std::byte* output) -> bool
+{
+    switch (type)
+    {
+        case data_type::uuid:
+        case data_type::timeuuid:
+        {
+            CassUuid cass_uuid{};
+            if (cass_value_get_uuid(cass_value, &cass_uuid) != CASS_OK)
+            {
+                return false;
+            }
+            std::memcpy(output, &cass_uuid, sizeof(cass_uuid));
+            return true;
+        }
+        case data_type::inet:
+        {
+            CassInet cass_inet{};
+            if (cass_value_get_inet(cass_value, &cass_inet) != CASS_OK)
+            {
+                return false;
+            }
+            std::memcpy(output, &cass_inet, sizeof(cass_inet));
+            return true;
+        }
+        case data_type::duration:
+        {
+            stored_duration stored{};
+            if (cass_value_get_duration(cass_value, &stored.months, &stored.days, &stored.nanos) != CASS_OK)
+            {
+                return false;
+            }
+            std::memcpy(output, &stored, sizeof(stored));
+            return true;
+        }
+        default:
+        {
+            ptr<const cass_byte_t> bytes{nullptr};
+            size_t                 size{0};
+            if (cass_value_get_bytes(cass_value, &bytes, &size) != CASS_OK || size != width)
+            {
+                return false;
+            }
+            std::memcpy(output, bytes, width);
+            return true;
+        }
+    }
+}
+
+auto to_host(std::byte* values, size_t width, size_t count) -> void
+{
+    switch (width)
+    {
+        case sizeof(uint16_t):
+            big_endian_to_host(reinterpret_cast<uint16_t*>(values), count);
+            break;
+        case sizeof(uint32_t):
+            big_endian_to_host(reinterpret_cast<uint32_t*>(values), count);
+            break;
+        case sizeof(uint64_t):
+            big_endian_to_host(reinterpret_cast<uint64_t*>(values), count);
+            break;
+        default:
+            break;
+    }
+}
+
+} // namespace
+
+auto detached_value::is_null() const -> bool
+{
+    return !m_result->is_valid(m_column, m_row);
+}
+
+auto detached_value::type() const -> data_type
+{
+    return m_result->layout(m_column).m_type;
+}
+
+template<typename value_type, data_type... types>
+auto detached_value::fixed() const -> std::optional<value_type>
+{
+    const auto& layout = m_result->layout(m_column);
+    if (((layout.m_type != types) && ...) || !m_result->is_valid(m_column, m_row))
+    {
+        return std::nullopt;
+    }
+
+    value_type output{};
+    std::memcpy(&output, m_result->m_arena + layout.m_values + m_row * layout.m_width, sizeof(output));
+    return {output};
+}
+
+auto detached_value::as_boolean() const -> std::optional<bool>
+{
+    auto byte = fixed<uint8_t, data_type::boolean>();
+    if (byte.has_value())
+    {
+        return {byte.value() != 0};
+    }
+    return std::nullopt;
+}
+
+auto detached_value::as_tiny_int() const -> std::optional<int8_t>
+{
+    return fixed<int8_t, data_type::tinyint>();
+}
+
+auto detached_value::as_small_int() const -> std::optional<int16_t>
+{
+    return fixed<int16_t, data_type::smallint>();
+}
+
+auto detached_value::as_int() const -> std::optional<int32_t>
+{
+    return fixed<int32_t, data_type::int_t>();
+}
+
+auto detached_value::as_big_int() const -> std::optional<int64_t>
+{
+    return fixed<int64_t, data_type::bigint, data_type::counter, data_type::timestamp, data_type::time>();
+}
+
+auto detached_value::as_counter() const -> std::optional<int64_t>
+{
+    return as_big_int();
+}
+
+auto detached_value::as_float() const -> std::optional<float>
+{
+    return fixed<float, data_type::float_t>();
+}
+
+auto detached_value::as_double() const -> std::optional<double>
+{
+    return fixed<double, data_type::double_t>();
+}
+
+auto detached_value::as_date() const -> std::optional<uint32_t>
+{
+    return fixed<uint32_t, data_type::date>();
+}
+
+auto detached_value::as_sys_days() const -> std::optional<sys_days>
+{
+    auto date_opt = as_date();
+    if (date_opt.has_value())
+    {
+        return {from_cql_date(date_opt.value())};
+    }
+    return std::nullopt;
+}
+
+auto detached_value::as_time() const -> std::optional<int64_t>
+{
+    return fixed<int64_t, data_type::time>();
+}
+
+auto detached_value::as_time_of_day() const -> std::optional<std::chrono::nanoseconds>
+{
+    auto time_opt = as_time();
+    if (time_opt.has_value())
+    {
+        return {from_cql_time(time_opt.value())};
+    }
+    return std::nullopt;
+}
+
+auto detached_value::as_timestamp() const -> std::optional<timestamp>
+{
+    auto millis = fixed<int64_t, data_type::timestamp>();
+    if (millis.has_value())
+    {
+        return {timestamp{std::chrono::milliseconds{millis.value()}}};
+    }
+    return std::nullopt;
+}
+
+auto detached_value::as_uuid() const -> std::optional<uuid>
+{
+    return fixed<CassUuid, data_type::uuid, data_type::timeuuid>();
+}
+
+auto detached_value::as_time_uuid() const -> std::optional<uuid>
+{
+    return as_uuid();
+}
+
+auto detached_value::as_inet() const -> std::optional<inet>
+{
+    auto cass_inet = fixed<CassInet, data_type::inet>();
+    if (cass_inet.has_value())
+    {
+        return {inet{cass_inet.value()}};
+    }
+    return std::nullopt;
+}
+
+auto detached_value::as_duration() const -> std::optional<duration>
+{
+    auto stored = fixed<stored_duration, data_type::duration>();
+    if (stored.has_value())
+    {
+        return {duration{stored.value().months, stored.value().days, stored.value().nanos}};
+    }
+    return std::nullopt;
+}
+
+auto detached_value::as_decimal() const -> std::optional<decimal>
+{
+    // Decimals are encoded as a 4 byte big endian scale followed by the unscaled varint.
+    auto bytes = as_blob();
+    if (!bytes.has_value() || type() != data_type::decimal || bytes.value().size() < sizeof(uint32_t))
+    {
+        return std::nullopt;
+    }
+
+    uint32_t scale{0};
+    std::memcpy(&scale, bytes.value().data(), sizeof(scale));
+    big_endian_to_host(&scale, 1);
+    return {decimal{
+        blob{bytes.value().data() + sizeof(scale), bytes.value().size() - sizeof(scale)},
+        static_cast<int32_t>(scale)}};
+}
+
+auto detached_value::as_varint() const -> std::optional<varint>
+{
+    auto bytes = as_blob();
+    if (!bytes.has_value() || type() != data_type::varint)
+    {
+        return std::nullopt;
+    }
+    return {varint{bytes.value()}};
+}
+
+auto detached_value::as_ascii() const -> std::optional<std::string>
+{
+    auto view = as_ascii_view();
+    if (view.has_value())
+    {
+        return {std::string{view.value()}};
+    }
+    return std::nullopt;
+}
+
+auto detached_value::as_ascii_view() const -> std::optional<std::string_view>
+{
+    auto bytes = as_blob();
+    if (bytes.has_value())
+    {
+        return {std::string_view{reinterpret_cast<const char*>(bytes.value().data()), bytes.value().size()}};
+    }
+    return std::nullopt;
+}
+
+auto detached_value::as_text() const -> std::optional<std::string>
+{
+    return as_ascii();
+}
+
+auto detached_value::as_text_view() const -> std::optional<std::string_view>
+{
+    return as_ascii_view();
+}
+
+auto detached_value::as_varchar() const -> std::optional<std::string>
+{
+    return as_ascii();
+}
+
+auto detached_value::as_varchar_view() const -> std::optional<std::string_view>
+{
+    return as_ascii_view();
+}
+
+auto detached_value::as_blob() const -> std::optional<blob>
+{
+    if (m_result->layout(m_column).m_width != 0 || !m_result->is_valid(m_column, m_row))
+    {
+        return std::nullopt;
+    }
+    return {m_result->heap_value(m_column, m_row)};
+}
+
+auto detached_row::column(std::string_view name) const -> detached_value
+{
+    auto index = m_result->column_index(name);
+    if (!index.has_value())
+    {
+        throw std::runtime_error("priam::detached_row: column " + std::string{name} + " does not exist.");
+    }
+    return detached_value{m_result, index.value(), m_row};
+}
+
+auto detached_row::column_count() const -> size_t
+{
+    return m_result->column_count();
+}
+
+detached_result::detached_result(
+    const CassResult* cass_result, priam::status status, std::pmr::memory_resource* memory_resource)
+    : m_memory_resource(memory_resource),
+      m_status(status)
+{
+    if (cass_result == nullptr)
+    {
+        return;
+    }
+
+    m_row_count    = cass_result_row_count(cass_result);
+    m_column_count = cass_result_column_count(cass_result);
+
+    // The first pass sizes every column's share of the heap so the whole result is a single allocation.
+    std::vector<data_type> types(m_column_count);
+    std::vector<size_t>    heap_sizes(m_column_count, 0);
+    size_t                 names_size{0};
+    for (size_t column = 0; column < m_column_count; ++column)
+    {
+        types[column] = to_data_type(cass_result_column_data_type(cass_result, column));
+
+        const char* name{nullptr};
+        size_t      name_length{0};
+        cass_result_column_name(cass_result, column, &name, &name_length);
+        names_size += name_length;
+    }
+
+    {
+        cass_iterator_ptr cass_iterator{cass_iterator_from_result(cass_result)};
+        while (cass_iterator_next(cass_iterator.get()))
+        {
+            const CassRow* cass_row = cass_iterator_get_row(cass_iterator.get());
+            for (size_t column = 0; column < m_column_count; ++column)
+            {
+                ptr<const cass_byte_t> bytes{nullptr};
+                size_t                 size{0};
+                if (fixed_width(types[column]) == 0 &&
+                    cass_value_get_bytes(cass_row_get_column(cass_row, column), &bytes, &size) == CASS_OK)
+                {
+                    heap_sizes[column] += size;
+                }
+            }
+        }
+    }
+
+    size_t heap_size{0};
+    for (auto size : heap_sizes)
+    {
+        heap_size += size;
+    }
+    if (heap_size > UINT32_MAX)
+    {
+        throw std::runtime_error("priam::detached_result: the result is too large to detach.");
+    }
+
+    // Column layouts, then each column's values or heap offsets and validity, then the names and the heap.
+    std::vector<column_layout> layouts(m_column_count);
+    size_t                     offset = align(m_column_count * sizeof(column_layout));
+    size_t                     validity_size{(m_row_count + 7) / 8};
+    for (size_t column = 0; column < m_column_count; ++column)
+    {
+        auto& layout   = layouts[column];
+        layout.m_type  = types[column];
+        layout.m_width = fixed_width(types[column]);
+
+        layout.m_values = offset;
+        offset += (layout.m_width != 0) ? m_row_count * layout.m_width : (m_row_count + 1) * sizeof(uint32_t);
+        layout.m_validity = offset;
+        offset            = align(offset + validity_size);
+    }
+    size_t names_offset = offset;
+    offset += names_size;
+    m_heap       = offset;
+    m_arena_size = offset + heap_size;
+
+    m_arena = static_cast<std::byte*>(m_memory_resource->allocate(m_arena_size, arena_alignment));
+    std::memset(m_arena, 0, m_arena_size);
+
+    size_t name_cursor = names_offset;
+    size_t heap_cursor{0};
+    for (size_t column = 0; column < m_column_count; ++column)
+    {
+        auto& layout = layouts[column];
+
+        const char* name{nullptr};
+        size_t      name_length{0};
+        cass_result_column_name(cass_result, column, &name, &name_length);
+        if (name_length > 0)
+        {
+            std::memcpy(m_arena + name_cursor, name, name_length);
+        }
+        layout.m_name        = name_cursor;
+        layout.m_name_length = name_length;
+        name_cursor += name_length;
+
+        if (layout.m_width == 0)
+        {
+            // Each column's values are contiguous in the heap, offset 'row' is where the row's value starts.
+            auto start = static_cast<uint32_t>(heap_cursor);
+            std::memcpy(m_arena + layout.m_values, &start, sizeof(start));
+            heap_cursor += heap_sizes[column];
+        }
+        new (m_arena + column * sizeof(column_layout)) column_layout{layout};
+    }
+
+    size_t            row{0};
+    cass_iterator_ptr cass_iterator{cass_iterator_from_result(cass_result)};
+    while (cass_iterator_next(cass_iterator.get()) && row < m_row_count)
+    {
+        const CassRow* cass_row = cass_iterator_get_row(cass_iterator.get());
+        for (size_t column = 0; column < m_column_count; ++column)
+        {
+            const auto&      layout     = layouts[column];
+            const CassValue* cass_value = cass_row_get_column(cass_row, column);
+            bool             valid{false};
+            if (layout.m_width != 0)
+            {
+                auto* output = m_arena + layout.m_values + row * layout.m_width;
+                valid        = !cass_value_is_null(cass_value) &&
+                        copy_fixed(cass_value, layout.m_type, layout.m_width, output);
+            }
+            else
+            {
+                auto*    offsets = m_arena + layout.m_values;
+                uint32_t start{0};
+                std::memcpy(&start, offsets + row * sizeof(uint32_t), sizeof(start));
+
+                ptr<const cass_byte_t> bytes{nullptr};
+                size_t                 size{0};
+                uint32_t               end = start;
+                if (!cass_value_is_null(cass_value) && cass_value_get_bytes(cass_value, &bytes, &size) == CASS_OK)
+                {
+                    if (size > 0)
+                    {
+                        std::memcpy(m_arena + m_heap + start, bytes, size);
+                    }
+                    end += static_cast<uint32_t>(size);
+                    valid = true;
+                }
+                std::memcpy(offsets + (row + 1) * sizeof(uint32_t), &end, sizeof(end));
+            }
+
+            if (valid)
+            {
+                m_arena[layout.m_validity + row / 8] |= static_cast<std::byte>(1U << (row % 8));
+            }
+        }
+        ++row;
+    }
+
+    for (const auto& layout : layouts)
+    {
+        if (is_network_order(layout.m_type))
+        {
+            to_host(m_arena + layout.m_values, layout.m_width, m_row_count);
+        }
+    }
+}
+
+detached_result::detached_result(detached_result&& other) noexcept
+    : m_memory_resource(std::exchange(other.m_memory_resource, nullptr)),
+      m_arena(std::exchange(other.m_arena, nullptr)),
+      m_arena_size(std::exchange(other.m_arena_size, 0)),
+      m_heap(std::exchange(other.m_heap, 0)),
+      m_row_count(std::exchange(other.m_row_count, 0)),
+      m_column_count(std::exchange(other.m_column_count, 0)),
+      m_status(other.m_status)
+{
+}
+
+auto detached_result::operator=(detached_result&& other) noexcept -> detached_result&
+{
+    if (std::addressof(other) != this)
+    {
+        release();
+        m_memory_resource = std::exchange(other.m_memory_resource, nullptr);
+        m_arena           = std::exchange(other.m_arena, nullptr);
+        m_arena_size      = std::exchange(other.m_arena_size, 0);
+        m_heap            = std::exchange(other.m_heap, 0);
+        m_row_count       = std::exchange(other.m_row_count, 0);
+        m_column_count    = std::exchange(other.m_column_count, 0);
+        m_status          = other.m_status;
+    }
+
+    return *this;
+}
+
+detached_result::~detached_result()
+{
+    release();
+}
+
+auto detached_result::column_name(size_t index) const -> std::string_view
+{
+    const auto& column = layout(index);
+    return std::string_view{reinterpret_cast<const char*>(m_arena + column.m_name), column.m_name_length};
+}
+
+auto detached_result::column_type(size_t index) const -> data_type
+{
+    return layout(index).m_type;
+}
+
+auto detached_result::column_index(std::string_view name) const -> std::optional<size_t>
+{
+    for (size_t i = 0; i < m_column_count; ++i)
+    {
+        if (column_name(i) == name)
+        {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+auto detached_result::is_valid(size_t column, size_t row) const -> bool
+{
+    auto bits = std::to_integer<uint8_t>(m_arena[layout(column).m_validity + row / 8]);
+    return ((bits >> (row % 8)) & 1U) != 0;
+}
+
+auto detached_result::heap_value(size_t column, size_t row) const -> blob
+{
+    const auto* offsets = m_arena + layout(column).m_values;
+    uint32_t    start{0};
+    uint32_t    end{0};
+    std::memcpy(&start, offsets + row * sizeof(uint32_t), sizeof(start));
+    std::memcpy(&end, offsets + (row + 1) * sizeof(uint32_t), sizeof(end));
+    return blob{m_arena + m_heap + start, end - start};
+}
+
+auto detached_result::release() -> void
+{
+    if (m_arena != nullptr)
+    {
+        m_memory_resource->deallocate(m_arena, m_arena_size, arena_alignment);
+        m_arena = nullptr;
+    }
+}
+
+} // namespace priam
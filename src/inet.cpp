@@ -0,0 +1,156 @@
+#include "priam/inet.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace priam
+{
+namespace
+{
+auto write_v4(const uint8_t* address, char* out) -> char*
+{
+    for (size_t i = 0; i < CASS_INET_V4_LENGTH; ++i)
+    {
+        if (i > 0)
+        {
+            *out++ = '.';
+        }
+
+        auto octet = address[i];
+        if (octet >= 100)
+        {
+            *out++ = static_cast<char>('0' + octet / 100);
+        }
+        if (octet >= 10)
+        {
+            *out++ = static_cast<char>('0' + (octet / 10) % 10);
+        }
+        *out++ = static_cast<char>('0' + octet % 10);
+    }
+    return out;
+}
+
+auto write_hex(uint16_t group, char* out) -> char*
+{
+    static constexpr char digits[] = "0123456789abcdef";
+
+    // Leading zeros are dropped, a zero group is a single '0'.
+    bool leading = true;
+    for (int shift = 12; shift >= 0; shift -= 4)
+    {
+        auto digit = (group >> shift) & 0xF;
+        if (digit != 0 || !leading || shift == 0)
+        {
+            *out++  = digits[digit];
+            leading = false;
+        }
+    }
+    return out;
+}
+
+auto write_v6(const uint8_t* address, char* out) -> char*
+{
+    uint16_t groups[8];
+    for (size_t i = 0; i < 8; ++i)
+    {
+        groups[i] = static_cast<uint16_t>((address[i * 2] << 8) | address[i * 2 + 1]);
+    }
+
+    // IPv4 mapped addresses keep the dotted IPv4 suffix, "::ffff:192.0.2.1".
+    static constexpr uint8_t v4_mapped_prefix[] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xFF, 0xFF};
+    if (std::memcmp(address, v4_mapped_prefix, sizeof(v4_mapped_prefix)) == 0)
+    {
+        static constexpr std::string_view prefix{"::ffff:"};
+        out = std::copy(prefix.begin(), prefix.end(), out);
+        return write_v4(address + sizeof(v4_mapped_prefix), out);
+    }
+
+    // The longest run of two or more zero groups, the first on a tie, is compressed to "::".
+    size_t best_start{8};
+    size_t best_length{0};
+    for (size_t i = 0; i < 8;)
+    {
+        if (groups[i] != 0)
+        {
+            ++i;
+            continue;
+        }
+        size_t start = i;
+        while (i < 8 && groups[i] == 0)
+        {
+            ++i;
+        }
+        if (i - start > best_length)
+        {
+            best_start  = start;
+            best_length = i - start;
+        }
+    }
+    if (best_length < 2)
+    {
+        best_start  = 8;
+        best_length = 0;
+    }
+
+    for (size_t i = 0; i < 8; ++i)
+    {
+        if (i == best_start)
+        {
+            *out++ = ':';
+            *out++ = ':';
+            i += best_length - 1;
+            continue;
+        }
+        if (i > 0 && i != best_start + best_length)
+        {
+            *out++ = ':';
+        }
+        out = write_hex(groups[i], out);
+    }
+    return out;
+}
+
+} // namespace
+
+inet::inet(const uint8_t* address, size_t size)
+{
+    size = std::min(size, static_cast<size_t>(CASS_INET_V6_LENGTH));
+    std::memcpy(m_cass_inet.address, address, size);
+    m_cass_inet.address_length = static_cast<cass_uint8_t>(size);
+}
+
+auto inet::from_string(std::string_view address) -> std::optional<inet>
+{
+    CassInet cass_inet{};
+    if (cass_inet_from_string_n(address.data(), address.length(), &cass_inet) != CASS_OK)
+    {
+        return std::nullopt;
+    }
+    return inet{cass_inet};
+}
+
+auto inet::to_chars(char* first) const -> char*
+{
+    if (is_v4())
+    {
+        return write_v4(data(), first);
+    }
+    if (is_v6())
+    {
+        return write_v6(data(), first);
+    }
+    return first;
+}
+
+auto inet::to_string() const -> std::string
+{
+    char buffer[max_string_length];
+    return std::string(buffer, to_chars(buffer));
+}
+
+auto inet::operator==(const inet& other) const -> bool
+{
+    return size() == other.size() && std::memcmp(data(), other.data(), size()) == 0;
+}
+
+} // namespace priam
@@ -6,4 +6,9 @@ map::map(const CassValue* cass_value) : m_cass_value(cass_value)
 {
 }
 
+statement_map::statement_map(size_t reserve_size)
+    : statement_collection(CassCollectionType::CASS_COLLECTION_TYPE_MAP, reserve_size)
+{
+}
+
 } // namespace priam
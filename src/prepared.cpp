@@ -1,8 +1,8 @@
 #include "priam/prepared.hpp"
 #include "priam/client.hpp"
 
-#include <algorithm>
 #include <stdexcept>
+#include <utility>
 
 namespace priam
 {
@@ -11,8 +11,24 @@ auto prepared::make_statement() const -> statement
     return statement{m_cass_prepared_ptr.get(), m_parameter_count};
 }
 
-prepared::prepared(client& client, std::string_view query)
-    : m_parameter_count(std::count(query.begin(), query.end(), '?'))
+auto prepared::acquire_statement() const -> statement
+{
+    return statement{m_statement_pool};
+}
+
+auto prepared::bind_index(std::string_view name) const -> std::optional<size_t>
+{
+    for (size_t i = 0; i < m_parameters.size(); ++i)
+    {
+        if (m_parameters[i].m_name == name)
+        {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+prepared::prepared(client& client, std::string_view query) : m_query(query)
 {
     auto prepare_future =
         cass_future_ptr(cass_session_prepare_n(client.m_cass_session_ptr.get(), query.data(), query.length()));
@@ -21,6 +37,7 @@ prepared::prepared(client& client, std::string_view query)
     if (rc == CASS_OK)
     {
         m_cass_prepared_ptr = cass_prepared_ptr(cass_future_get_prepared(prepare_future.get()));
+        initialize();
     }
     else
     {
@@ -28,4 +45,31 @@ prepared::prepared(client& client, std::string_view query)
     }
 }
 
+prepared::prepared(cass_prepared_ptr cass_prepared, std::string_view query)
+    : m_cass_prepared_ptr(std::move(cass_prepared)),
+      m_query(query)
+{
+    initialize();
+}
+
+auto prepared::initialize() -> void
+{
+    // The driver reports an error once the position is past the last parameter.
+    const char* name;
+    size_t      name_length;
+    for (size_t i = 0;
+         cass_prepared_parameter_name(m_cass_prepared_ptr.get(), i, &name, &name_length) == CassError::CASS_OK;
+         ++i)
+    {
+        const auto* cass_data_type = cass_prepared_parameter_data_type(m_cass_prepared_ptr.get(), i);
+        auto        type           = (cass_data_type != nullptr)
+                          ? static_cast<data_type>(cass_data_type_type(cass_data_type))
+                          : data_type::unknown;
+        m_parameters.push_back(parameter{std::string{name, name_length}, type});
+    }
+
+    m_parameter_count = m_parameters.size();
+    m_statement_pool  = std::make_shared<statement_pool>(m_cass_prepared_ptr.get(), m_parameter_count);
+}
+
 } // namespace priam
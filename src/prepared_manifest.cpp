@@ -0,0 +1,166 @@
+#include "priam/prepared_manifest.hpp"
+
+#include <fstream>
+#include <stdexcept>
+#include <utility>
+
+namespace priam
+{
+static auto escape(std::string& out, const std::string& field) -> void
+{
+    // A leading '#' would read back as a comment line.
+    if (!field.empty() && field.front() == '#')
+    {
+        out.push_back('\\');
+    }
+
+    for (auto c : field)
+    {
+        switch (c)
+        {
+            case '\\':
+                out.append("\\\\");
+                break;
+            case '\t':
+                out.append("\\t");
+                break;
+            case '\n':
+                out.append("\\n");
+                break;
+            case '\r':
+                out.append("\\r");
+                break;
+            default:
+                out.push_back(c);
+                break;
+        }
+    }
+}
+
+static auto malformed(size_t line_number, const char* reason) -> std::runtime_error
+{
+    return std::runtime_error(
+        "priam::prepared_manifest_read: line " + std::to_string(line_number) + " is malformed, " + reason);
+}
+
+auto prepared_manifest_write(std::ostream& out, const std::vector<prepared_definition>& definitions) -> void
+{
+    std::string line{};
+    for (const auto& definition : definitions)
+    {
+        if (definition.name.empty())
+        {
+            throw std::runtime_error("priam::prepared_manifest_write: a prepared statement has an empty name.");
+        }
+
+        line.clear();
+        escape(line, definition.name);
+        line.push_back('\t');
+        escape(line, definition.query);
+        line.push_back('\n');
+        out.write(line.data(), static_cast<std::streamsize>(line.size()));
+    }
+
+    out.flush();
+    if (!out)
+    {
+        throw std::runtime_error("priam::prepared_manifest_write: failed to write the manifest.");
+    }
+}
+
+auto prepared_manifest_write(const std::string& path, const std::vector<prepared_definition>& definitions)
+    -> void
+{
+    std::ofstream out{path, std::ios::out | std::ios::trunc | std::ios::binary};
+    if (!out)
+    {
+        throw std::runtime_error("priam::prepared_manifest_write: failed to open " + path);
+    }
+    prepared_manifest_write(out, definitions);
+}
+
+auto prepared_manifest_read(std::istream& in) -> std::vector<prepared_definition>
+{
+    std::vector<prepared_definition> definitions{};
+    std::string                      line{};
+    size_t                           line_number{0};
+
+    while (std::getline(in, line))
+    {
+        ++line_number;
+        if (!line.empty() && line.back() == '\r')
+        {
+            line.pop_back();
+        }
+        if (line.empty() || line.front() == '#')
+        {
+            continue;
+        }
+
+        prepared_definition definition{};
+        std::string*        field = &definition.name;
+        for (size_t i = 0; i < line.size(); ++i)
+        {
+            auto c = line[i];
+            if (c == '\t')
+            {
+                if (field == &definition.query)
+                {
+                    throw malformed(line_number, "unexpected unescaped tab.");
+                }
+                field = &definition.query;
+            }
+            else if (c == '\\')
+            {
+                if (++i == line.size())
+                {
+                    throw malformed(line_number, "dangling escape.");
+                }
+                switch (line[i])
+                {
+                    case '\\':
+                        field->push_back('\\');
+                        break;
+                    case 't':
+                        field->push_back('\t');
+                        break;
+                    case 'n':
+                        field->push_back('\n');
+                        break;
+                    case 'r':
+                        field->push_back('\r');
+                        break;
+                    case '#':
+                        field->push_back('#');
+                        break;
+                    default:
+                        throw malformed(line_number, "unknown escape.");
+                }
+            }
+            else
+            {
+                field->push_back(c);
+            }
+        }
+
+        if (field != &definition.query || definition.name.empty())
+        {
+            throw malformed(line_number, "expected 'name<TAB>query'.");
+        }
+        definitions.push_back(std::move(definition));
+    }
+
+    return definitions;
+}
+
+auto prepared_manifest_read(const std::string& path) -> std::vector<prepared_definition>
+{
+    std::ifstream in{path, std::ios::in | std::ios::binary};
+    if (!in)
+    {
+        throw std::runtime_error("priam::prepared_manifest_read: failed to open " + path);
+    }
+    return prepared_manifest_read(in);
+}
+
+} // namespace priam
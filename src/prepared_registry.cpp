@@ -0,0 +1,138 @@
+#include "priam/prepared_registry.hpp"
+#include "priam/prepared.hpp"
+
+#include <functional>
+#include <stdexcept>
+
+namespace priam
+{
+static_assert(sizeof(size_t) == sizeof(uint64_t), "priam::prepared_registry requires 64 bit size_t.");
+
+prepared_registry::prepared_registry()
+{
+    m_name_tables.emplace_back(std::make_unique<name_table>(chunk_base_size));
+    m_names.store(m_name_tables.back().get(), std::memory_order_release);
+}
+
+prepared_registry::~prepared_registry() = default;
+
+auto prepared_registry::insert(std::string name, std::shared_ptr<prepared> prepared_ptr) -> prepared_handle
+{
+    std::lock_guard<std::mutex> guard{m_writer_mutex};
+
+    // The first registration of a name wins, a duplicate is not stored.
+    auto* names = m_name_tables.back().get();
+    if (const auto* existing = names->find(name); existing != nullptr)
+    {
+        return existing->m_handle;
+    }
+
+    auto index = m_size.load(std::memory_order_relaxed);
+    if (index == prepared_handle::invalid_index)
+    {
+        throw std::length_error("priam::prepared_registry: too many prepared statements registered.");
+    }
+
+    auto [chunk, offset] = locate(index);
+    if (chunk >= chunk_count)
+    {
+        throw std::length_error("priam::prepared_registry: too many prepared statements registered.");
+    }
+
+    if (offset == 0)
+    {
+        auto chunk_size = chunk_base_size << chunk;
+        m_chunk_storage.emplace_back(std::make_unique<std::atomic<prepared*>[]>(chunk_size));
+        for (size_t i = 0; i < chunk_size; ++i)
+        {
+            m_chunk_storage.back()[i].store(nullptr, std::memory_order_relaxed);
+        }
+        m_chunks[chunk].store(m_chunk_storage.back().get(), std::memory_order_release);
+    }
+
+    prepared_handle handle{index};
+    // The handle must be set before the prepared statement is published to readers.
+    prepared_ptr->m_handle = handle;
+
+    m_entries.emplace_back(std::make_unique<entry>(entry{std::move(name), std::move(prepared_ptr), handle}));
+    const entry* e = m_entries.back().get();
+
+    m_chunks[chunk].load(std::memory_order_relaxed)[offset].store(
+        e->m_prepared_ptr.get(), std::memory_order_release);
+    m_size.store(index + 1, std::memory_order_release);
+
+    // Keep the load factor at or below 1/2 so probe sequences stay short.
+    if ((names->m_used + 1) * 2 > names->m_mask + 1)
+    {
+        auto grown = std::make_unique<name_table>((names->m_mask + 1) * 2);
+        for (const auto& existing : m_entries)
+        {
+            grown->insert(existing.get());
+        }
+        m_name_tables.emplace_back(std::move(grown));
+        m_names.store(m_name_tables.back().get(), std::memory_order_release);
+    }
+    else
+    {
+        names->insert(e);
+    }
+
+    return handle;
+}
+
+auto prepared_registry::find(std::string_view name) const -> prepared_handle
+{
+    const auto* e = m_names.load(std::memory_order_acquire)->find(name);
+    return (e != nullptr) ? e->m_handle : prepared_handle{};
+}
+
+auto prepared_registry::definitions() const -> std::vector<prepared_definition>
+{
+    std::lock_guard<std::mutex> guard{m_writer_mutex};
+
+    std::vector<prepared_definition> definitions{};
+    definitions.reserve(m_entries.size());
+    for (const auto& e : m_entries)
+    {
+        definitions.push_back(prepared_definition{e->m_name, e->m_prepared_ptr->query()});
+    }
+    return definitions;
+}
+
+prepared_registry::name_table::name_table(size_t capacity)
+    : m_slots(std::make_unique<std::atomic<const entry*>[]>(capacity)),
+      m_mask(capacity - 1)
+{
+    for (size_t i = 0; i < capacity; ++i)
+    {
+        m_slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+auto prepared_registry::name_table::find(std::string_view name) const -> const entry*
+{
+    for (auto i = std::hash<std::string_view>{}(name);; ++i)
+    {
+        const auto* e = m_slots[i & m_mask].load(std::memory_order_acquire);
+        if (e == nullptr || e->m_name == name)
+        {
+            return e;
+        }
+    }
+}
+
+auto prepared_registry::name_table::insert(const entry* e) -> void
+{
+    for (auto i = std::hash<std::string_view>{}(e->m_name);; ++i)
+    {
+        auto& slot = m_slots[i & m_mask];
+        if (slot.load(std::memory_order_relaxed) == nullptr)
+        {
+            slot.store(e, std::memory_order_release);
+            ++m_used;
+            return;
+        }
+    }
+}
+
+} // namespace priam
@@ -0,0 +1,204 @@
+#include "priam/rate_limited_client.hpp"
+#include "priam/result.hpp"
+
+#include <algorithm>
+#include <utility>
+
+namespace priam
+{
+rate_limited_client::rate_limited_client(client& client, double requests_per_second, double bytes_per_second)
+    : m_client(client),
+      m_requests(requests_per_second),
+      m_bytes(bytes_per_second),
+      m_dispatcher([this]() { dispatch(); })
+{
+}
+
+rate_limited_client::~rate_limited_client()
+{
+    cancel();
+    {
+        std::lock_guard<std::mutex> guard{m_mutex};
+        m_stop = true;
+    }
+    m_cv.notify_all();
+    m_dispatcher.join();
+}
+
+auto rate_limited_client::requests_per_second(double rate, double burst) -> void
+{
+    {
+        std::lock_guard<std::mutex> guard{m_mutex};
+        m_requests.rate(rate, burst);
+    }
+    m_cv.notify_all();
+}
+
+auto rate_limited_client::requests_per_second() const -> double
+{
+    std::lock_guard<std::mutex> guard{m_mutex};
+    return m_requests.rate();
+}
+
+auto rate_limited_client::bytes_per_second(double rate, double burst) -> void
+{
+    {
+        std::lock_guard<std::mutex> guard{m_mutex};
+        m_bytes.rate(rate, burst);
+    }
+    m_cv.notify_all();
+}
+
+auto rate_limited_client::bytes_per_second() const -> double
+{
+    std::lock_guard<std::mutex> guard{m_mutex};
+    return m_bytes.rate();
+}
+
+auto rate_limited_client::execute_statement(
+    const statement& statement, std::chrono::milliseconds timeout, consistency c, size_t request_bytes)
+    -> priam::result
+{
+    {
+        std::unique_lock<std::mutex> lock{m_mutex};
+        // Only skip the queue if nothing is waiting ahead of this statement, otherwise wait on the
+        // dispatcher to admit it in order.
+        if (!m_queue.empty() || acquire(request_bytes) != std::chrono::nanoseconds{0})
+        {
+            waiter turn{};
+            m_queue.push_back(queued_statement{std::nullopt, nullptr, timeout, c, request_bytes, &turn});
+            m_cv.notify_all();
+            m_cv.wait(lock, [&turn]() { return turn.m_admitted || turn.m_cancelled; });
+            if (turn.m_cancelled)
+            {
+                return priam::result{status::client_request_timed_out};
+            }
+        }
+    }
+
+    return m_client.execute_statement(statement, timeout, c);
+}
+
+auto rate_limited_client::execute_statement(
+    statement                   statement,
+    std::function<void(result)> on_complete_callback,
+    std::chrono::milliseconds   timeout,
+    consistency                 c,
+    size_t                      request_bytes) -> void
+{
+    {
+        std::lock_guard<std::mutex> guard{m_mutex};
+        // Only skip the queue if nothing is waiting ahead of this statement.
+        if (!m_queue.empty() || acquire(request_bytes) != std::chrono::nanoseconds{0})
+        {
+            m_queue.push_back(queued_statement{
+                std::move(statement), std::move(on_complete_callback), timeout, c, request_bytes, nullptr});
+            m_cv.notify_all();
+            return;
+        }
+    }
+
+    m_client.execute_statement(std::move(statement), std::move(on_complete_callback), timeout, c);
+}
+
+auto rate_limited_client::queued() const -> size_t
+{
+    std::lock_guard<std::mutex> guard{m_mutex};
+    return m_queue.size();
+}
+
+auto rate_limited_client::drain(std::chrono::milliseconds timeout) -> bool
+{
+    std::unique_lock<std::mutex> lock{m_mutex};
+    return m_cv.wait_for(lock, timeout, [this]() { return m_queue.empty(); });
+}
+
+auto rate_limited_client::cancel() -> size_t
+{
+    std::deque<queued_statement> cancelled{};
+    {
+        std::lock_guard<std::mutex> guard{m_mutex};
+        cancelled.swap(m_queue);
+        for (auto& next : cancelled)
+        {
+            if (next.m_waiter != nullptr)
+            {
+                next.m_waiter->m_cancelled = true;
+            }
+        }
+    }
+    m_cv.notify_all();
+
+    // Called outside the lock so callbacks can submit statements.
+    for (auto& next : cancelled)
+    {
+        if (next.m_waiter == nullptr && next.m_on_complete_callback != nullptr)
+        {
+            next.m_on_complete_callback(priam::result{status::client_request_timed_out});
+        }
+    }
+    return cancelled.size();
+}
+
+auto rate_limited_client::acquire(size_t request_bytes) -> std::chrono::nanoseconds
+{
+    auto now   = token_bucket::clock::now();
+    auto bytes = static_cast<double>(request_bytes);
+    auto wait  = std::max(m_requests.wait_time(1.0, now), m_bytes.wait_time(bytes, now));
+    if (wait == std::chrono::nanoseconds{0})
+    {
+        m_requests.try_acquire(1.0, now);
+        m_bytes.try_acquire(bytes, now);
+    }
+    return wait;
+}
+
+auto rate_limited_client::dispatch() -> void
+{
+    std::unique_lock<std::mutex> lock{m_mutex};
+    while (true)
+    {
+        if (m_queue.empty())
+        {
+            if (m_stop)
+            {
+                return;
+            }
+            m_cv.wait(lock);
+            continue;
+        }
+
+        auto& front = m_queue.front();
+        auto  wait  = acquire(front.m_request_bytes);
+        if (wait != std::chrono::nanoseconds{0})
+        {
+            // Woken early if the limits change.
+            m_cv.wait_for(lock, wait);
+            continue;
+        }
+
+        if (front.m_waiter != nullptr)
+        {
+            // The synchronous caller executes the statement on its own thread.
+            front.m_waiter->m_admitted = true;
+            m_queue.pop_front();
+            m_cv.notify_all();
+            continue;
+        }
+
+        auto next = std::move(front);
+        m_queue.pop_front();
+        if (m_queue.empty())
+        {
+            m_cv.notify_all();
+        }
+
+        // Execute outside the lock, the driver can invoke the callback inline on failure.
+        lock.unlock();
+        m_client.execute_statement(
+            std::move(*next.m_statement), std::move(next.m_on_complete_callback), next.m_timeout, next.m_consistency);
+        lock.lock();
+    }
+}
+
+} // namespace priam
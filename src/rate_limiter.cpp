@@ -0,0 +1,70 @@
+#include "priam/rate_limiter.hpp"
+
+#include <algorithm>
+
+namespace priam
+{
+token_bucket::token_bucket(double rate, double burst)
+{
+    this->rate(rate, burst, m_last_refill);
+    m_tokens = m_burst;
+}
+
+auto token_bucket::rate(double rate, double burst, clock::time_point now) -> void
+{
+    refill(now);
+
+    m_rate  = std::max(rate, 0.0);
+    m_burst = (burst > 0.0) ? burst : m_rate;
+    // Don't let a lowered burst keep tokens accrued at the previous, larger, burst.
+    m_tokens = std::min(m_tokens, m_burst);
+}
+
+auto token_bucket::wait_time(double tokens, clock::time_point now) -> std::chrono::nanoseconds
+{
+    if (unlimited())
+    {
+        return std::chrono::nanoseconds{0};
+    }
+
+    refill(now);
+
+    // Requests larger than the burst are let through once the bucket is full.
+    auto required = std::min(tokens, m_burst);
+    if (m_tokens >= required)
+    {
+        return std::chrono::nanoseconds{0};
+    }
+
+    std::chrono::duration<double> seconds{(required - m_tokens) / m_rate};
+    // Round up so the caller doesn't wake up just before the tokens are available.
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(seconds) + std::chrono::nanoseconds{1};
+}
+
+auto token_bucket::try_acquire(double tokens, clock::time_point now) -> bool
+{
+    if (unlimited())
+    {
+        return true;
+    }
+
+    if (wait_time(tokens, now) != std::chrono::nanoseconds{0})
+    {
+        return false;
+    }
+
+    m_tokens -= tokens;
+    return true;
+}
+
+auto token_bucket::refill(clock::time_point now) -> void
+{
+    if (now > m_last_refill)
+    {
+        std::chrono::duration<double> elapsed = now - m_last_refill;
+        m_tokens                              = std::min(m_burst, m_tokens + elapsed.count() * m_rate);
+        m_last_refill                         = now;
+    }
+}
+
+} // namespace priam
@@ -1,37 +1,206 @@
 #include "priam/result.hpp"
 #include "priam/cpp_driver.hpp"
 
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+
 namespace priam
 {
 auto result::begin() const -> iterator
 {
     if (m_cass_result_ptr == nullptr)
     {
-        return end();
+        return iterator{};
     }
 
     cass_iterator_ptr cass_iterator_ptr{cass_iterator_from_result(m_cass_result_ptr.get())};
     if (cass_iterator_ptr == nullptr)
     {
-        return end();
+        return iterator{};
     }
 
     if (!cass_iterator_next(cass_iterator_ptr.get()))
     {
-        return end();
+        return iterator{};
     }
 
     const CassRow* cass_row = cass_iterator_get_row(cass_iterator_ptr.get());
     if (cass_row == nullptr)
     {
-        return end();
+        return iterator{};
     }
     return iterator{std::move(cass_iterator_ptr), cass_row};
 }
 
-auto result::end() const -> iterator
+auto result::column(std::string_view name) const -> const column_handle&
+{
+    for (const auto& column : m_columns)
+    {
+        if (column.m_name == name)
+        {
+            return column;
+        }
+    }
+    throw std::runtime_error("priam::result: column " + std::string{name} + " does not exist.");
+}
+
+auto result::column_index(std::string_view name) const -> std::optional<size_t>
+{
+    for (const auto& column : m_columns)
+    {
+        if (column.m_name == name)
+        {
+            return column.m_index;
+        }
+    }
+    return std::nullopt;
+}
+
+auto result::row_at(size_t index) const -> detached_row
 {
-    return iterator{nullptr, nullptr};
+    if (m_row_index == nullptr)
+    {
+        throw std::runtime_error("priam::result::row_at: the result has no rows.");
+    }
+    return indexed_rows().row_at(index);
+}
+
+auto result::indexed_rows() const -> const detached_result&
+{
+    std::call_once(m_row_index->m_built, [this]() {
+        m_row_index->m_rows =
+            detached_result{m_cass_result_ptr.get(), m_status, std::pmr::get_default_resource()};
+    });
+    return m_row_index->m_rows;
+}
+
+auto result::detach(std::pmr::memory_resource* memory_resource) -> detached_result
+{
+    detached_result detached{m_cass_result_ptr.get(), m_status, memory_resource};
+    m_row_index.reset();
+    m_columns.clear();
+    m_cass_result_ptr.reset();
+    m_cass_future_ptr.reset();
+    return detached;
+}
+
+auto result::task_latch::fail(std::exception_ptr error) -> void
+{
+    std::lock_guard<std::mutex> guard{m_mutex};
+    if (m_error == nullptr)
+    {
+        m_error = std::move(error);
+    }
+}
+
+auto result::task_latch::count_down() -> void
+{
+    std::lock_guard<std::mutex> guard{m_mutex};
+    if (--m_remaining == 0)
+    {
+        m_done.notify_all();
+    }
+}
+
+auto result::task_latch::wait() -> void
+{
+    std::unique_lock<std::mutex> lock{m_mutex};
+    m_done.wait(lock, [this]() { return m_remaining == 0; });
+    if (m_error != nullptr)
+    {
+        std::rethrow_exception(m_error);
+    }
+}
+
+auto result::check_column(const column_handle& column, bool (*accepts)(const CassDataType*)) const -> void
+{
+    if (!accepts(column.m_cass_data_type))
+    {
+        throw std::runtime_error(
+            "priam::result: column " + std::string{column.m_name} + " of type " + to_string(column.m_type) +
+            " does not match its C++ type.");
+    }
+}
+
+auto result::resolve_field(std::string_view name, bool (*accepts)(const CassDataType*)) const -> size_t
+{
+    const auto& column = this->column(name);
+    check_column(column, accepts);
+    return column.m_index;
+}
+
+auto result::decode_fixed(const column_handle& column, size_t width, uint8_t* values, column_validity& validity) const
+    -> void
+{
+    auto rows = row_count();
+    validity.m_size = rows;
+    validity.m_validity.assign((rows + 7) / 8, 0);
+    if (m_cass_result_ptr == nullptr)
+    {
+        return;
+    }
+
+    size_t            row{0};
+    cass_iterator_ptr cass_iterator_ptr{cass_iterator_from_result(m_cass_result_ptr.get())};
+    while (cass_iterator_next(cass_iterator_ptr.get()))
+    {
+        const CassRow*     cass_row   = cass_iterator_get_row(cass_iterator_ptr.get());
+        const CassValue*   cass_value = cass_row_get_column(cass_row, column.m_index);
+        const cass_byte_t* bytes{nullptr};
+        size_t             size{0};
+        if (cass_value_get_bytes(cass_value, &bytes, &size) == CASS_OK && size == width)
+        {
+            std::memcpy(values + row * width, bytes, width);
+            validity.m_validity[row / 8] |= static_cast<uint8_t>(1U << (row % 8));
+        }
+        else
+        {
+            ++validity.m_null_count;
+        }
+        ++row;
+    }
+}
+
+auto result::decode_dictionary(const column_handle& column, priam::column_view<std::string_view>& view) const -> void
+{
+    auto rows = row_count();
+    view.m_size = rows;
+    view.m_validity.assign((rows + 7) / 8, 0);
+    view.m_indices.assign(rows, 0);
+    if (m_cass_result_ptr == nullptr)
+    {
+        return;
+    }
+
+    std::unordered_map<std::string_view, int32_t> indices{};
+
+    size_t            row{0};
+    cass_iterator_ptr cass_iterator_ptr{cass_iterator_from_result(m_cass_result_ptr.get())};
+    while (cass_iterator_next(cass_iterator_ptr.get()))
+    {
+        const CassRow*   cass_row   = cass_iterator_get_row(cass_iterator_ptr.get());
+        const CassValue* cass_value = cass_row_get_column(cass_row, column.m_index);
+        const char*      text{nullptr};
+        size_t           text_length{0};
+        if (cass_value_get_string(cass_value, &text, &text_length) == CASS_OK)
+        {
+            std::string_view value{text, text_length};
+            auto [iter, inserted] = indices.try_emplace(value, static_cast<int32_t>(view.m_dictionary.size()));
+            if (inserted)
+            {
+                view.m_dictionary.emplace_back(value);
+            }
+            view.m_indices[row] = iter->second;
+            view.m_validity[row / 8] |= static_cast<uint8_t>(1U << (row % 8));
+        }
+        else
+        {
+            ++view.m_null_count;
+        }
+        ++row;
+    }
 }
 
 result::result(CassFuture* query_future)
@@ -39,6 +208,24 @@ result::result(CassFuture* query_future)
       m_cass_result_ptr(cass_future_get_result(m_cass_future_ptr.get())),
       m_status(static_cast<priam::status>(cass_future_error_code(m_cass_future_ptr.get())))
 {
+    const auto* cass_result = m_cass_result_ptr.get();
+    if (cass_result == nullptr)
+    {
+        return;
+    }
+
+    m_row_index = std::make_unique<row_index>();
+
+    auto count = cass_result_column_count(cass_result);
+    m_columns.reserve(count);
+    for (size_t i = 0; i < count; ++i)
+    {
+        const char* name{nullptr};
+        size_t      name_length{0};
+        cass_result_column_name(cass_result, i, &name, &name_length);
+        m_columns.push_back(
+            column_handle{i, std::string_view{name, name_length}, cass_result_column_data_type(cass_result, i)});
+    }
 }
 
 } // namespace priam
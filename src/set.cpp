@@ -6,4 +6,9 @@ set::set(const CassValue* cass_value) : m_cass_value(cass_value)
 {
 }
 
+statement_set::statement_set(size_t reserve_size)
+    : statement_collection(CassCollectionType::CASS_COLLECTION_TYPE_SET, reserve_size)
+{
+}
+
 } // namespace priam
@@ -1,15 +1,138 @@
 #include "priam/statement.hpp"
+#include "priam/auto_prepare_cache.hpp"
+#include "priam/byte_order.hpp"
+#include "priam/uuid.hpp"
 
 #include <algorithm>
+#include <cctype>
+#include <memory>
+#include <utility>
+#include <vector>
 
 namespace priam
 {
+/**
+ * Counts the bind markers in a query, '?' markers and distinct ':name' markers.  Markers inside string
+ * literals, quoted identifiers and comments are skipped.
+ * @param query The cql query.
+ * @return The number of parameters to bind.
+ */
+static auto count_parameters(std::string_view query) -> size_t
+{
+    auto is_identifier_start = [](char c) { return std::isalpha(static_cast<unsigned char>(c)) || c == '_'; };
+    auto is_identifier       = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+
+    // Skips from a quote to just past its closing quote, a doubled quote is an escaped quote.
+    auto skip_quoted = [&query](size_t i, char quote) -> size_t {
+        for (++i; i < query.length(); ++i)
+        {
+            if (query[i] == quote)
+            {
+                if (i + 1 < query.length() && query[i + 1] == quote)
+                {
+                    ++i;
+                    continue;
+                }
+                return i + 1;
+            }
+        }
+        return query.length();
+    };
+
+    auto skip_until = [&query](size_t i, std::string_view end) -> size_t {
+        auto found = query.find(end, i);
+        return (found == std::string_view::npos) ? query.length() : found + end.length();
+    };
+
+    size_t                        positional{0};
+    std::vector<std::string_view> names{};
+
+    size_t i = 0;
+    while (i < query.length())
+    {
+        auto c    = query[i];
+        auto next = (i + 1 < query.length()) ? query[i + 1] : '\0';
+
+        if (c == '\'' || c == '"')
+        {
+            i = skip_quoted(i, c);
+        }
+        else if (c == '$' && next == '$')
+        {
+            i = skip_until(i + 2, "$$");
+        }
+        else if ((c == '-' && next == '-') || (c == '/' && next == '/'))
+        {
+            i = skip_until(i + 2, "\n");
+        }
+        else if (c == '/' && next == '*')
+        {
+            i = skip_until(i + 2, "*/");
+        }
+        else if (c == '?')
+        {
+            ++positional;
+            ++i;
+        }
+        else if (c == ':' && is_identifier_start(next))
+        {
+            auto end = i + 1;
+            while (end < query.length() && is_identifier(query[end]))
+            {
+                ++end;
+            }
+            auto name = query.substr(i + 1, end - i - 1);
+            if (std::find(names.begin(), names.end(), name) == names.end())
+            {
+                names.push_back(name);
+            }
+            i = end;
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    return positional + names.size();
+}
+
 statement::statement(std::string_view query)
-    : m_parameter_count(std::count(query.begin(), query.end(), '?')),
+    : m_query(auto_prepare_cache::intern(query)),
+      m_parameter_count(count_parameters(query)),
       m_cass_statement_ptr(cass_statement_new_n(query.data(), query.length(), m_parameter_count))
 {
 }
 
+statement::statement(statement&& other)
+    : m_query(std::move(other.m_query)),
+      m_parameter_count(std::exchange(other.m_parameter_count, 0)),
+      m_cass_statement_ptr(std::move(other.m_cass_statement_ptr)),
+      m_pool(std::move(other.m_pool)),
+      m_recyclable(other.m_recyclable.load(std::memory_order_relaxed))
+{
+}
+
+statement::~statement()
+{
+    release_to_pool();
+}
+
+auto statement::operator=(statement&& other) -> statement&
+{
+    if (std::addressof(other) != this)
+    {
+        release_to_pool();
+
+        m_query              = std::move(other.m_query);
+        m_parameter_count    = std::exchange(other.m_parameter_count, 0);
+        m_cass_statement_ptr = std::move(other.m_cass_statement_ptr);
+        m_pool               = std::move(other.m_pool);
+        m_recyclable.store(other.m_recyclable.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    }
+    return *this;
+}
+
 // statement::statement(statement&& other)
 //     : m_parameter_count(std::exchange(other.m_parameter_count, 0)),
 //       m_cass_statement_ptr(std::move(other.m_cass_statement_ptr))
@@ -64,24 +187,20 @@ auto statement::bind_uuid(uuid uuid, std::string_view name) -> status
 auto statement::bind_uuid(std::string_view uuid, size_t position) -> status
 {
     CassUuid cass_uuid{};
-    // Cass lib seems very particular about the length always being "36".
-    size_t    length = (uuid.length() >= CASS_UUID_STRING_LENGTH) ? 36 : uuid.length();
-    CassError rc     = cass_uuid_from_string_n(uuid.data(), length, &cass_uuid);
-    if (rc != CASS_OK)
+    // Any trailing characters past the 36 byte uuid, like a null terminator, are ignored.
+    if (!from_chars(uuid.substr(0, uuid_string_length), cass_uuid))
     {
-        return static_cast<status>(rc);
+        return status::client_bad_params;
     }
     return static_cast<status>(cass_statement_bind_uuid(m_cass_statement_ptr.get(), position, cass_uuid));
 }
 
 auto statement::bind_uuid(std::string_view uuid, std::string_view name) -> status
 {
-    CassUuid  cass_uuid{};
-    size_t    length = (uuid.length() >= CASS_UUID_STRING_LENGTH) ? 36 : uuid.length();
-    CassError rc     = cass_uuid_from_string_n(uuid.data(), length, &cass_uuid);
-    if (rc != CASS_OK)
+    CassUuid cass_uuid{};
+    if (!from_chars(uuid.substr(0, uuid_string_length), cass_uuid))
     {
-        return static_cast<status>(rc);
+        return status::client_bad_params;
     }
     return static_cast<status>(
         cass_statement_bind_uuid_by_name_n(m_cass_statement_ptr.get(), name.data(), name.length(), cass_uuid));
@@ -166,6 +285,54 @@ auto statement::bind_list(statement_list list, std::string_view name) -> status
         m_cass_statement_ptr.get(), name.data(), name.length(), list.m_cass_collection_ptr.get()));
 }
 
+auto statement::bind_set(statement_set set, size_t position) -> status
+{
+    return static_cast<status>(
+        cass_statement_bind_collection(m_cass_statement_ptr.get(), position, set.m_cass_collection_ptr.get()));
+}
+
+auto statement::bind_set(statement_set set, std::string_view name) -> status
+{
+    return static_cast<status>(cass_statement_bind_collection_by_name_n(
+        m_cass_statement_ptr.get(), name.data(), name.length(), set.m_cass_collection_ptr.get()));
+}
+
+auto statement::bind_map(statement_map map, size_t position) -> status
+{
+    return static_cast<status>(
+        cass_statement_bind_collection(m_cass_statement_ptr.get(), position, map.m_cass_collection_ptr.get()));
+}
+
+auto statement::bind_map(statement_map map, std::string_view name) -> status
+{
+    return static_cast<status>(cass_statement_bind_collection_by_name_n(
+        m_cass_statement_ptr.get(), name.data(), name.length(), map.m_cass_collection_ptr.get()));
+}
+
+auto statement::bind_tuple(statement_tuple tuple, size_t position) -> status
+{
+    return static_cast<status>(
+        cass_statement_bind_tuple(m_cass_statement_ptr.get(), position, tuple.m_cass_tuple_ptr.get()));
+}
+
+auto statement::bind_tuple(statement_tuple tuple, std::string_view name) -> status
+{
+    return static_cast<status>(cass_statement_bind_tuple_by_name_n(
+        m_cass_statement_ptr.get(), name.data(), name.length(), tuple.m_cass_tuple_ptr.get()));
+}
+
+auto statement::bind_user_type(statement_user_type user_type, size_t position) -> status
+{
+    return static_cast<status>(
+        cass_statement_bind_user_type(m_cass_statement_ptr.get(), position, user_type.m_cass_user_type_ptr.get()));
+}
+
+auto statement::bind_user_type(statement_user_type user_type, std::string_view name) -> status
+{
+    return static_cast<status>(cass_statement_bind_user_type_by_name_n(
+        m_cass_statement_ptr.get(), name.data(), name.length(), user_type.m_cass_user_type_ptr.get()));
+}
+
 auto statement::bind_blob(blob blob, size_t position) -> status
 {
     return static_cast<status>(cass_statement_bind_bytes(
@@ -182,6 +349,100 @@ auto statement::bind_blob(blob blob, std::string_view name) -> status
         blob.size()));
 }
 
+auto statement::bind_varint(const varint& value, size_t position) -> status
+{
+    return static_cast<status>(cass_statement_bind_bytes(
+        m_cass_statement_ptr.get(), position, reinterpret_cast<ptr<const cass_uint8_t>>(value.data()), value.size()));
+}
+
+auto statement::bind_varint(const varint& value, std::string_view name) -> status
+{
+    return static_cast<status>(cass_statement_bind_bytes_by_name_n(
+        m_cass_statement_ptr.get(),
+        name.data(),
+        name.length(),
+        reinterpret_cast<ptr<const cass_uint8_t>>(value.data()),
+        value.size()));
+}
+
+auto statement::bind_decimal(const decimal& value, size_t position) -> status
+{
+    const auto& unscaled = value.varint();
+    return static_cast<status>(cass_statement_bind_decimal(
+        m_cass_statement_ptr.get(),
+        position,
+        reinterpret_cast<ptr<const cass_uint8_t>>(unscaled.data()),
+        unscaled.size(),
+        value.scale()));
+}
+
+auto statement::bind_decimal(const decimal& value, std::string_view name) -> status
+{
+    const auto& unscaled = value.varint();
+    return static_cast<status>(cass_statement_bind_decimal_by_name_n(
+        m_cass_statement_ptr.get(),
+        name.data(),
+        name.length(),
+        reinterpret_cast<ptr<const cass_uint8_t>>(unscaled.data()),
+        unscaled.size(),
+        value.scale()));
+}
+
+/**
+ * Encodes vector elements big endian into a buffer reused by the calling thread.
+ * @return The encoded elements, valid until the thread encodes another vector of the same element type.
+ */
+template<typename element_type>
+static auto encode_vector(const element_type* values, size_t count) -> const std::vector<element_type>&
+{
+    thread_local std::vector<element_type> buffer{};
+    buffer.assign(values, values + count);
+    host_to_big_endian(buffer.data(), buffer.size());
+    return buffer;
+}
+
+auto statement::bind_vector(const float* values, size_t count, size_t position) -> status
+{
+    const auto& encoded = encode_vector(values, count);
+    return static_cast<status>(cass_statement_bind_bytes(
+        m_cass_statement_ptr.get(),
+        position,
+        reinterpret_cast<ptr<const cass_uint8_t>>(encoded.data()),
+        encoded.size() * sizeof(float)));
+}
+
+auto statement::bind_vector(const float* values, size_t count, std::string_view name) -> status
+{
+    const auto& encoded = encode_vector(values, count);
+    return static_cast<status>(cass_statement_bind_bytes_by_name_n(
+        m_cass_statement_ptr.get(),
+        name.data(),
+        name.length(),
+        reinterpret_cast<ptr<const cass_uint8_t>>(encoded.data()),
+        encoded.size() * sizeof(float)));
+}
+
+auto statement::bind_vector(const double* values, size_t count, size_t position) -> status
+{
+    const auto& encoded = encode_vector(values, count);
+    return static_cast<status>(cass_statement_bind_bytes(
+        m_cass_statement_ptr.get(),
+        position,
+        reinterpret_cast<ptr<const cass_uint8_t>>(encoded.data()),
+        encoded.size() * sizeof(double)));
+}
+
+auto statement::bind_vector(const double* values, size_t count, std::string_view name) -> status
+{
+    const auto& encoded = encode_vector(values, count);
+    return static_cast<status>(cass_statement_bind_bytes_by_name_n(
+        m_cass_statement_ptr.get(),
+        name.data(),
+        name.length(),
+        reinterpret_cast<ptr<const cass_uint8_t>>(encoded.data()),
+        encoded.size() * sizeof(double)));
+}
+
 auto statement::reset() -> status
 {
     return static_cast<status>(cass_statement_reset_parameters(m_cass_statement_ptr.get(), m_parameter_count));
@@ -193,4 +454,22 @@ statement::statement(const CassPrepared* cass_prepared, size_t parameter_count)
 {
 }
 
+auto statement::release_to_pool() -> void
+{
+    // The driver retains its own reference to a statement that is still in flight, freeing ours is safe but
+    // resetting it for reuse is not.
+    if (m_pool != nullptr && m_recyclable.load(std::memory_order_relaxed))
+    {
+        m_pool->release(std::move(m_cass_statement_ptr));
+    }
+    m_cass_statement_ptr.reset();
+}
+
+statement::statement(std::shared_ptr<statement_pool> pool)
+    : m_parameter_count(pool->parameter_count()),
+      m_cass_statement_ptr(pool->acquire()),
+      m_pool(std::move(pool))
+{
+}
+
 } // namespace priam
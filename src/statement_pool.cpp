@@ -0,0 +1,103 @@
+#include "priam/statement_pool.hpp"
+
+#include <functional>
+#include <thread>
+
+namespace priam
+{
+statement_pool::statement_pool(const CassPrepared* cass_prepared, size_t parameter_count, size_t capacity)
+    : m_cass_prepared(cass_prepared),
+      m_parameter_count(parameter_count),
+      m_capacity(capacity),
+      m_slots(std::make_unique<std::atomic<CassStatement*>[]>(capacity))
+{
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+        m_slots[i].store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+statement_pool::~statement_pool()
+{
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+        auto* cass_statement = m_slots[i].load(std::memory_order_relaxed);
+        if (cass_statement != nullptr)
+        {
+            cass_statement_free(cass_statement);
+        }
+    }
+}
+
+auto statement_pool::acquire() -> cass_statement_ptr
+{
+    auto start = start_slot();
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+        auto& slot = m_slots[(start + i) % m_capacity];
+        if (slot.load(std::memory_order_relaxed) != nullptr)
+        {
+            auto* cass_statement = slot.exchange(nullptr, std::memory_order_acquire);
+            if (cass_statement != nullptr)
+            {
+                return cass_statement_ptr(cass_statement);
+            }
+        }
+    }
+
+    return cass_statement_ptr(cass_prepared_bind(m_cass_prepared));
+}
+
+auto statement_pool::release(cass_statement_ptr cass_statement) -> void
+{
+    if (cass_statement == nullptr)
+    {
+        return;
+    }
+
+    cass_statement_reset_parameters(cass_statement.get(), m_parameter_count);
+    // CASS_UINT64_MAX restores the cluster's default request timeout.
+    cass_statement_set_request_timeout(cass_statement.get(), CASS_UINT64_MAX);
+
+    auto start = start_slot();
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+        auto&          slot     = m_slots[(start + i) % m_capacity];
+        CassStatement* expected = nullptr;
+        if (slot.load(std::memory_order_relaxed) == nullptr &&
+            slot.compare_exchange_strong(expected, cass_statement.get(), std::memory_order_release))
+        {
+            cass_statement.release();
+            return;
+        }
+    }
+
+    // The pool is full, the statement is freed by its deleter.
+}
+
+auto statement_pool::size() const -> size_t
+{
+    size_t count{0};
+    for (size_t i = 0; i < m_capacity; ++i)
+    {
+        if (m_slots[i].load(std::memory_order_relaxed) != nullptr)
+        {
+            ++count;
+        }
+    }
+    return count;
+}
+
+auto statement_pool::start_slot() const -> size_t
+{
+    if (m_capacity == 0)
+    {
+        return 0;
+    }
+
+    // Hashing the thread id once per thread spreads threads across the slots.
+    thread_local const size_t thread_hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
+    return thread_hash % m_capacity;
+}
+
+} // namespace priam
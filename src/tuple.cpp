@@ -6,4 +6,18 @@ tuple::tuple(const CassValue* cass_value) : m_cass_value(cass_value)
 {
 }
 
+statement_tuple::statement_tuple(size_t item_count) : m_cass_tuple_ptr(cass_tuple_new(item_count))
+{
+}
+
+auto statement_tuple::append_null() -> bool
+{
+    if (cass_tuple_set_null(m_cass_tuple_ptr.get(), m_index) != CASS_OK)
+    {
+        return false;
+    }
+    ++m_index;
+    return true;
+}
+
 } // namespace priam
@@ -0,0 +1,44 @@
+#include "priam/user_type.hpp"
+
+#include <stdexcept>
+
+namespace priam
+{
+statement_user_type::statement_user_type(const CassDataType* cass_data_type)
+    : m_cass_data_type(cass_data_type),
+      m_cass_user_type_ptr(
+          data_type_is<data_type::udt>(cass_data_type) ? cass_user_type_new_from_data_type(cass_data_type) : nullptr)
+{
+    if (m_cass_user_type_ptr == nullptr)
+    {
+        throw std::runtime_error("priam::statement_user_type: the data type is not a user defined type.");
+    }
+}
+
+auto statement_user_type::field_count() const -> size_t
+{
+    return cass_data_type_sub_type_count(m_cass_data_type);
+}
+
+auto statement_user_type::field_index(std::string_view name) const -> std::optional<size_t>
+{
+    auto count = field_count();
+    for (size_t i = 0; i < count; ++i)
+    {
+        const char* field_name{nullptr};
+        size_t      field_name_length{0};
+        if (cass_data_type_sub_type_name(m_cass_data_type, i, &field_name, &field_name_length) == CASS_OK &&
+            std::string_view{field_name, field_name_length} == name)
+        {
+            return i;
+        }
+    }
+    return std::nullopt;
+}
+
+auto statement_user_type::set_null(size_t index) -> bool
+{
+    return cass_user_type_set_null(m_cass_user_type_ptr.get(), index) == CASS_OK;
+}
+
+} // namespace priam
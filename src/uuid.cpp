@@ -0,0 +1,310 @@
+#include "priam/uuid.hpp"
+
+#include <array>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(__i386__)
+    #include <immintrin.h>
+    #define PRIAM_UUID_X86 1
+#endif
+
+namespace priam
+{
+namespace
+{
+/// The number of hex digits in a uuid.
+constexpr size_t hex_length = 32;
+
+/// The positions of the dashes in a formatted uuid.
+constexpr std::array<size_t, 4> dash_positions{8, 13, 18, 23};
+
+constexpr char hex_digits[] = "0123456789abcdef";
+
+/**
+ * @return The uuid's 16 bytes in the order they are formatted, the time_low, time_mid and time_hi_and_version
+ *         fields of 'time_and_version' followed by 'clock_seq_and_node', each big endian.
+ */
+auto to_bytes(const uuid& value, uint8_t* out) -> void
+{
+    auto time = value.time_and_version;
+    auto node = value.clock_seq_and_node;
+
+    const uint64_t fields[] = {time & 0xFFFFFFFF, (time >> 32) & 0xFFFF, time >> 48};
+    const size_t   widths[] = {4, 2, 2};
+    for (size_t field = 0; field < 3; ++field)
+    {
+        for (size_t i = 0; i < widths[field]; ++i)
+        {
+            *out++ = static_cast<uint8_t>(fields[field] >> (8 * (widths[field] - 1 - i)));
+        }
+    }
+    for (size_t i = 0; i < 8; ++i)
+    {
+        *out++ = static_cast<uint8_t>(node >> (8 * (7 - i)));
+    }
+}
+
+auto from_bytes(const uint8_t* bytes) -> uuid
+{
+    auto read = [&](size_t offset, size_t width) -> uint64_t {
+        uint64_t output{0};
+        for (size_t i = 0; i < width; ++i)
+        {
+            output = (output << 8) | bytes[offset + i];
+        }
+        return output;
+    };
+
+    uuid output{};
+    output.time_and_version   = read(0, 4) | (read(4, 2) << 32) | (read(6, 2) << 48);
+    output.clock_seq_and_node = read(8, 8);
+    return output;
+}
+
+auto hex_encode_scalar(const uuid& value, char* hex) -> void
+{
+    uint8_t bytes[16];
+    to_bytes(value, bytes);
+    for (auto byte : bytes)
+    {
+        *hex++ = hex_digits[byte >> 4];
+        *hex++ = hex_digits[byte & 0x0F];
+    }
+}
+
+/**
+ * @return The value of the hex digit 'c', or -1 if it is not a hex digit.
+ */
+constexpr auto hex_value(char c) -> int
+{
+    if (c >= '0' && c <= '9')
+    {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f')
+    {
+        return c - 'a' + 10;
+    }
+    if (c >= 'A' && c <= 'F')
+    {
+        return c - 'A' + 10;
+    }
+    return -1;
+}
+
+auto hex_decode_scalar(const char* hex, uuid& value) -> bool
+{
+    uint8_t bytes[16];
+    for (size_t i = 0; i < sizeof(bytes); ++i)
+    {
+        auto high = hex_value(hex[i * 2]);
+        auto low  = hex_value(hex[i * 2 + 1]);
+        if (high < 0 || low < 0)
+        {
+            return false;
+        }
+        bytes[i] = static_cast<uint8_t>((high << 4) | low);
+    }
+    value = from_bytes(bytes);
+    return true;
+}
+
+#if defined(PRIAM_UUID_X86) && !(defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+
+/**
+ * Shuffles a uuid in memory into its formatted byte order, on little endian hosts the bytes of time_low,
+ * time_mid, time_hi_and_version and clock_seq_and_node are each reversed.  The shuffle is its own inverse so
+ * it also shuffles formatted bytes back into a uuid.
+ */
+__attribute__((target("ssse3"))) auto shuffle_mask() -> __m128i
+{
+    return _mm_setr_epi8(3, 2, 1, 0, 5, 4, 7, 6, 15, 14, 13, 12, 11, 10, 9, 8);
+}
+
+__attribute__((target("ssse3"))) auto hex_encode_ssse3(const uuid& value, char* hex) -> void
+{
+    const __m128i lut   = _mm_loadu_si128(reinterpret_cast<const __m128i*>(hex_digits));
+    const __m128i low4  = _mm_set1_epi8(0x0F);
+    const __m128i bytes = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&value)), shuffle_mask());
+
+    auto high = _mm_shuffle_epi8(lut, _mm_and_si128(_mm_srli_epi16(bytes, 4), low4));
+    auto low  = _mm_shuffle_epi8(lut, _mm_and_si128(bytes, low4));
+
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(hex), _mm_unpacklo_epi8(high, low));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(hex + 16), _mm_unpackhi_epi8(high, low));
+}
+
+__attribute__((target("avx2"))) auto hex_encode_avx2(const uuid& value, char* hex) -> void
+{
+    const __m128i bytes = _mm_shuffle_epi8(_mm_loadu_si128(reinterpret_cast<const __m128i*>(&value)), shuffle_mask());
+
+    // Widen each byte to 16 bits holding its high nibble in the first byte and its low nibble in the second, so
+    // a single shuffle through the digit table writes all 32 hex digits in order.
+    auto wide    = _mm256_cvtepu8_epi16(bytes);
+    auto nibbles = _mm256_or_si256(
+        _mm256_srli_epi16(wide, 4), _mm256_slli_epi16(_mm256_and_si256(wide, _mm256_set1_epi16(0x0F)), 8));
+    auto lut = _mm256_broadcastsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex_digits)));
+
+    _mm256_storeu_si256(reinterpret_cast<__m256i*>(hex), _mm256_shuffle_epi8(lut, nibbles));
+}
+
+/**
+ * Converts 16 hex digits into their values and reports which are valid.
+ */
+__attribute__((target("ssse3"))) auto hex_values_ssse3(__m128i digits, __m128i& valid) -> __m128i
+{
+    auto lower    = _mm_or_si128(digits, _mm_set1_epi8(0x20));
+    auto is_digit = _mm_and_si128(
+        _mm_cmpgt_epi8(digits, _mm_set1_epi8('0' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('9' + 1), digits));
+    auto is_alpha = _mm_and_si128(
+        _mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)), _mm_cmpgt_epi8(_mm_set1_epi8('f' + 1), lower));
+
+    valid = _mm_or_si128(is_digit, is_alpha);
+    return _mm_or_si128(
+        _mm_and_si128(is_digit, _mm_sub_epi8(digits, _mm_set1_epi8('0'))),
+        _mm_andnot_si128(is_digit, _mm_sub_epi8(lower, _mm_set1_epi8('a' - 10))));
+}
+
+__attribute__((target("ssse3"))) auto hex_decode_ssse3(const char* hex, uuid& value) -> bool
+{
+    __m128i valid_first{};
+    __m128i valid_second{};
+    auto    first  = hex_values_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex)), valid_first);
+    auto    second = hex_values_ssse3(_mm_loadu_si128(reinterpret_cast<const __m128i*>(hex + 16)), valid_second);
+    if (_mm_movemask_epi8(_mm_and_si128(valid_first, valid_second)) != 0xFFFF)
+    {
+        return false;
+    }
+
+    // Each pair of digits becomes high * 16 + low.
+    const __m128i weights = _mm_set1_epi16(0x0110);
+    auto bytes = _mm_packus_epi16(_mm_maddubs_epi16(first, weights), _mm_maddubs_epi16(second, weights));
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&value), _mm_shuffle_epi8(bytes, shuffle_mask()));
+    return true;
+}
+
+__attribute__((target("avx2"))) auto hex_decode_avx2(const char* hex, uuid& value) -> bool
+{
+    auto digits   = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(hex));
+    auto lower    = _mm256_or_si256(digits, _mm256_set1_epi8(0x20));
+    auto is_digit = _mm256_and_si256(
+        _mm256_cmpgt_epi8(digits, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), digits));
+    auto is_alpha = _mm256_and_si256(
+        _mm256_cmpgt_epi8(lower, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('f' + 1), lower));
+    if (static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_or_si256(is_digit, is_alpha))) != 0xFFFFFFFF)
+    {
+        return false;
+    }
+
+    auto values = _mm256_blendv_epi8(
+        _mm256_sub_epi8(lower, _mm256_set1_epi8('a' - 10)), _mm256_sub_epi8(digits, _mm256_set1_epi8('0')), is_digit);
+
+    // Each pair of digits becomes high * 16 + low, the pack leaves each lane's 8 bytes in its low half.
+    auto pairs  = _mm256_maddubs_epi16(values, _mm256_set1_epi16(0x0110));
+    auto packed = _mm256_permute4x64_epi64(_mm256_packus_epi16(pairs, pairs), 0b00001000);
+    auto bytes  = _mm256_castsi256_si128(packed);
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(&value), _mm_shuffle_epi8(bytes, shuffle_mask()));
+    return true;
+}
+
+auto hex_encode(const uuid& value, char* hex) -> void
+{
+    static const bool has_avx2  = (__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+    static const bool has_ssse3 = __builtin_cpu_supports("ssse3");
+
+    if (has_avx2)
+    {
+        hex_encode_avx2(value, hex);
+    }
+    else if (has_ssse3)
+    {
+        hex_encode_ssse3(value, hex);
+    }
+    else
+    {
+        hex_encode_scalar(value, hex);
+    }
+}
+
+auto hex_decode(const char* hex, uuid& value) -> bool
+{
+    static const bool has_avx2  = (__builtin_cpu_init(), __builtin_cpu_supports("avx2"));
+    static const bool has_ssse3 = __builtin_cpu_supports("ssse3");
+
+    if (has_avx2)
+    {
+        return hex_decode_avx2(hex, value);
+    }
+    if (has_ssse3)
+    {
+        return hex_decode_ssse3(hex, value);
+    }
+    return hex_decode_scalar(hex, value);
+}
+
+#else
+
+auto hex_encode(const uuid& value, char* hex) -> void
+{
+    hex_encode_scalar(value, hex);
+}
+
+auto hex_decode(const char* hex, uuid& value) -> bool
+{
+    return hex_decode_scalar(hex, value);
+}
+
+#endif
+
+} // namespace
+
+auto to_chars(char* first, const uuid& value) -> char*
+{
+    char hex[hex_length];
+    hex_encode(value, hex);
+
+    // 8-4-4-4-12
+    std::memcpy(first, hex, 8);
+    std::memcpy(first + 9, hex + 8, 4);
+    std::memcpy(first + 14, hex + 12, 4);
+    std::memcpy(first + 19, hex + 16, 4);
+    std::memcpy(first + 24, hex + 20, 12);
+    for (auto position : dash_positions)
+    {
+        first[position] = '-';
+    }
+    return first + uuid_string_length;
+}
+
+auto from_chars(std::string_view input, uuid& value) -> bool
+{
+    if (input.length() != uuid_string_length)
+    {
+        return false;
+    }
+    for (auto position : dash_positions)
+    {
+        if (input[position] != '-')
+        {
+            return false;
+        }
+    }
+
+    char hex[hex_length];
+    std::memcpy(hex, input.data(), 8);
+    std::memcpy(hex + 8, input.data() + 9, 4);
+    std::memcpy(hex + 12, input.data() + 14, 4);
+    std::memcpy(hex + 16, input.data() + 19, 4);
+    std::memcpy(hex + 20, input.data() + 24, 12);
+    return hex_decode(hex, value);
+}
+
+auto to_string(uuid uuid) -> std::string
+{
+    std::string output;
+    output.resize(uuid_string_length);
+    to_chars(output.data(), uuid);
+    return output;
+}
+
+} // namespace priam
@@ -1,16 +1,131 @@
 #include "priam/uuid_generator.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <random>
+#include <ratio>
+
 namespace priam
 {
-auto to_string(uuid uuid) -> std::string
+namespace
 {
-    // The CASS_UUID_STRING_LENGTH includes the null terminator.
-    std::string output;
-    output.resize(CASS_UUID_STRING_LENGTH - 1);
-    cass_uuid_string(uuid, output.data());
-    return output;
+/// The number of 100ns intervals between the uuid v1 epoch, 1582-10-15, and the unix epoch.
+constexpr uint64_t gregorian_offset = 0x01B21DD213814000;
+
+/// The RFC 4122 variant bits '10' in the top of clock_seq_and_node.
+constexpr uint64_t variant_bits = uint64_t{0b10} << 62;
+
+constexpr uint64_t node_mask      = 0x0000FFFFFFFFFFFF;
+constexpr uint64_t multicast_bit  = 0x0000010000000000;
+constexpr uint16_t clock_seq_mask = 0x3FFF;
+
+/// uuid v7 counters start in the lower half of their 12 bits to leave room to count within a millisecond.
+constexpr uint16_t v7_counter_seed_mask = 0x07FF;
+constexpr uint16_t v7_counter_max       = 0x0FFF;
+
+auto random_seed() -> uint64_t
+{
+    std::random_device device{};
+    return (uint64_t{device()} << 32) | device();
 }
 
+/**
+ * @return The random node shared by every thread, the multicast bit marks it as not being a hardware address.
+ */
+auto process_node() -> uint64_t
+{
+    static const uint64_t node = (random_seed() & node_mask) | multicast_bit;
+    return node;
+}
+
+/**
+ * @return A clock sequence that differs from every other thread's until it wraps after 16384 threads.
+ */
+auto next_clock_seq() -> uint64_t
+{
+    static std::atomic<uint16_t> clock_seq{static_cast<uint16_t>(random_seed())};
+    return clock_seq.fetch_add(1, std::memory_order_relaxed) & clock_seq_mask;
+}
+
+struct thread_state
+{
+    /// splitmix64 state for the random bits in uuid v7.
+    uint64_t random{random_seed()};
+    /// The variant, clock sequence and node of every uuid v1 this thread generates.
+    uint64_t clock_seq_and_node{variant_bits | (next_clock_seq() << 48) | process_node()};
+    /// The last uuid v1 timestamp, 100ns intervals since the gregorian epoch.
+    uint64_t last_v1_timestamp{0};
+    /// The last uuid v7 timestamp, milliseconds since the unix epoch.
+    uint64_t last_v7_millis{0};
+    /// The last uuid v7 counter within 'last_v7_millis'.
+    uint16_t v7_counter{0};
+
+    auto next_random() -> uint64_t
+    {
+        uint64_t z = (random += 0x9E3779B97F4A7C15);
+        z          = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9;
+        z          = (z ^ (z >> 27)) * 0x94D049BB133111EB;
+        return z ^ (z >> 31);
+    }
+};
+
+auto local_state() -> thread_state&
+{
+    thread_local thread_state state{};
+    return state;
+}
+
+auto generate_v1(uuid* first, size_t count) -> void
+{
+    using intervals = std::chrono::duration<int64_t, std::ratio<1, 10'000'000>>;
+
+    auto& state = local_state();
+    auto  since_epoch =
+        std::chrono::duration_cast<intervals>(std::chrono::system_clock::now().time_since_epoch()).count();
+    auto timestamp = std::max(gregorian_offset + static_cast<uint64_t>(since_epoch), state.last_v1_timestamp + 1);
+
+    for (size_t i = 0; i < count; ++i, ++timestamp)
+    {
+        // time_low, time_mid and time_hi are the timestamp's low, middle and high bits in order, the top nibble
+        // is the version.
+        first[i].time_and_version   = (timestamp & 0x0FFFFFFFFFFFFFFF) | (uint64_t{1} << 60);
+        first[i].clock_seq_and_node = state.clock_seq_and_node;
+        state.last_v1_timestamp     = timestamp;
+    }
+}
+
+auto generate_v7(uuid* first, size_t count) -> void
+{
+    auto& state  = local_state();
+    auto  millis = static_cast<uint64_t>(
+        std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::system_clock::now().time_since_epoch())
+            .count());
+
+    for (size_t i = 0; i < count; ++i)
+    {
+        if (millis > state.last_v7_millis)
+        {
+            state.last_v7_millis = millis;
+            state.v7_counter     = static_cast<uint16_t>(state.next_random() & v7_counter_seed_mask);
+        }
+        else if (++state.v7_counter > v7_counter_max)
+        {
+            // The counter is exhausted, borrow the next millisecond.
+            ++state.last_v7_millis;
+            state.v7_counter = static_cast<uint16_t>(state.next_random() & v7_counter_seed_mask);
+        }
+
+        // The 48 bit timestamp is the first 12 hex digits, so its high 32 bits are time_low.
+        auto timestamp              = state.last_v7_millis & 0x0000FFFFFFFFFFFF;
+        auto version_and_counter    = uint64_t{0x7000} | state.v7_counter;
+        first[i].time_and_version   = (timestamp >> 16) | ((timestamp & 0xFFFF) << 32) | (version_and_counter << 48);
+        first[i].clock_seq_and_node = variant_bits | (state.next_random() >> 2);
+    }
+}
+
+} // namespace
+
 uuid_generator::uuid_generator() : m_uuid_gen_ptr(cass_uuid_gen_new())
 {
 }
@@ -40,4 +155,31 @@ auto uuid_generator::uuid_v4() -> uuid
     return uuid;
 }
 
+auto thread_uuid_generator::uuid_v1() -> uuid
+{
+    uuid output{};
+    generate_v1(&output, 1);
+    return output;
+}
+
+auto thread_uuid_generator::uuid_v7() -> uuid
+{
+    uuid output{};
+    generate_v7(&output, 1);
+    return output;
+}
+
+auto thread_uuid_generator::generate(uuid* first, size_t count, version version) -> void
+{
+    switch (version)
+    {
+        case version::v1:
+            generate_v1(first, count);
+            break;
+        case version::v7:
+            generate_v7(first, count);
+            break;
+    }
+}
+
 } // namespace priam
@@ -1,31 +1,61 @@
 #include "priam/value.hpp"
+#include "priam/byte_order.hpp"
 #include "priam/list.hpp"
 #include "priam/map.hpp"
 #include "priam/set.hpp"
 #include "priam/tuple.hpp"
 
-#include <ctime>
+#include <cstring>
 #include <string>
 
 namespace priam
 {
+namespace
+{
+template<typename element_type>
+auto decode_vector(const CassValue* cass_value, element_type* output, size_t capacity) -> std::optional<size_t>
+{
+    ptr<const cass_byte_t> bytes{nullptr};
+    size_t                 bytes_size{0};
+    if (cass_value_get_bytes(cass_value, &bytes, &bytes_size) != CASS_OK || bytes_size % sizeof(element_type) != 0)
+    {
+        return std::nullopt;
+    }
+
+    auto count = bytes_size / sizeof(element_type);
+    if (count > capacity)
+    {
+        return std::nullopt;
+    }
+
+    std::memcpy(output, bytes, bytes_size);
+    big_endian_to_host(output, count);
+    return {count};
+}
+
+} // namespace
+
 auto value::is_null() const -> bool
 {
     return static_cast<bool>(cass_value_is_null(m_cass_value));
 }
 
-auto value::type() const -> data_type
+auto value::lookup_type() const -> data_type
+{
+    return to_data_type(cass_value_data_type(m_cass_value));
+}
+
+auto value::as_ascii() const -> std::optional<std::string>
 {
-    const CassDataType* cass_data_type = cass_value_data_type(m_cass_value);
-    if (cass_data_type != nullptr)
+    auto view_opt = as_ascii_view();
+    if (view_opt.has_value())
     {
-        return static_cast<data_type>(cass_data_type_type(cass_data_type));
+        return {std::string{view_opt.value()}};
     }
-
-    return data_type::unknown;
+    return std::nullopt;
 }
 
-auto value::as_ascii() const -> std::optional<std::string>
+auto value::as_ascii_view() const -> std::optional<std::string_view>
 {
     if (!is_null())
     {
@@ -33,12 +63,23 @@ auto value::as_ascii() const -> std::optional<std::string>
         size_t      output_len{0};
         if (cass_value_get_string(m_cass_value, &output, &output_len) == CASS_OK)
         {
-            return {std::string(output, output_len)};
+            return {std::string_view{output, output_len}};
         }
     }
     return std::nullopt;
 }
 
+auto value::as_ascii(std::string& output) const -> bool
+{
+    auto view_opt = as_ascii_view();
+    if (view_opt.has_value())
+    {
+        output.assign(view_opt.value());
+        return true;
+    }
+    return false;
+}
+
 auto value::as_big_int() const -> std::optional<int64_t>
 {
     if (!is_null())
@@ -52,6 +93,29 @@ auto value::as_big_int() const -> std::optional<int64_t>
     return std::nullopt;
 }
 
+auto value::as_custom() const -> std::optional<blob>
+{
+    return as_blob();
+}
+
+auto value::as_vector(float* output, size_t capacity) const -> std::optional<size_t>
+{
+    if (is_null())
+    {
+        return std::nullopt;
+    }
+    return decode_vector(m_cass_value, output, capacity);
+}
+
+auto value::as_vector(double* output, size_t capacity) const -> std::optional<size_t>
+{
+    if (is_null())
+    {
+        return std::nullopt;
+    }
+    return decode_vector(m_cass_value, output, capacity);
+}
+
 auto value::as_blob() const -> std::optional<blob>
 {
     if (!is_null())
@@ -151,14 +215,24 @@ auto value::as_text() const -> std::optional<std::string>
     return as_ascii();
 }
 
-auto value::as_timestamp() const -> std::optional<std::time_t>
+auto value::as_text_view() const -> std::optional<std::string_view>
+{
+    return as_ascii_view();
+}
+
+auto value::as_text(std::string& output) const -> bool
+{
+    return as_ascii(output);
+}
+
+auto value::as_timestamp() const -> std::optional<timestamp>
 {
     if (!is_null())
     {
-        cass_uint32_t year_month_day{0};
-        if (cass_value_get_uint32(m_cass_value, &year_month_day) == CASS_OK)
+        cass_int64_t millis{0};
+        if (cass_value_get_int64(m_cass_value, &millis) == CASS_OK)
         {
-            return {static_cast<std::time_t>(year_month_day)};
+            return {timestamp{std::chrono::milliseconds{millis}}};
         }
     }
     return std::nullopt;
@@ -169,9 +243,7 @@ auto value::as_timestamp_date_formatted() const -> std::optional<std::string>
     auto timestamp_opt = as_timestamp();
     if (timestamp_opt.has_value())
     {
-        char        buffer[26];
-        std::string output{ctime_r(&timestamp_opt.value(), buffer)};
-        return {std::move(output)};
+        return {to_iso8601(timestamp_opt.value())};
     }
     return std::nullopt;
 }
@@ -194,9 +266,24 @@ auto value::as_varchar() const -> std::optional<std::string>
     return as_ascii();
 }
 
-auto value::as_varint() const -> std::optional<blob>
+auto value::as_varchar_view() const -> std::optional<std::string_view>
 {
-    return as_blob();
+    return as_ascii_view();
+}
+
+auto value::as_varchar(std::string& output) const -> bool
+{
+    return as_ascii(output);
+}
+
+auto value::as_varint() const -> std::optional<varint>
+{
+    auto bytes = as_blob();
+    if (bytes.has_value())
+    {
+        return {varint{bytes.value()}};
+    }
+    return std::nullopt;
 }
 
 auto value::as_time_uuid() const -> std::optional<uuid>
@@ -204,23 +291,14 @@ auto value::as_time_uuid() const -> std::optional<uuid>
     return as_uuid();
 }
 
-auto value::as_inet() const -> std::optional<std::string>
+auto value::as_inet() const -> std::optional<inet>
 {
     if (!is_null())
     {
-        // TODO make this function return the struct and provide a priam::to_string()
-        CassInet cass_inet;
+        CassInet cass_inet{};
         if (cass_value_get_inet(m_cass_value, &cass_inet) == CASS_OK)
         {
-            std::string output(CASS_INET_STRING_LENGTH, '\0');
-            cass_inet_string(cass_inet, output.data());
-
-            auto pos = output.find('\0');
-            if (pos != std::string::npos)
-            {
-                output.resize(pos);
-            }
-            return {std::move(output)};
+            return {inet{cass_inet}};
         }
     }
     return std::nullopt;
@@ -239,6 +317,16 @@ auto value::as_date() const -> std::optional<uint32_t>
     return std::nullopt;
 }
 
+auto value::as_sys_days() const -> std::optional<sys_days>
+{
+    auto date_opt = as_date();
+    if (date_opt.has_value())
+    {
+        return {from_cql_date(date_opt.value())};
+    }
+    return std::nullopt;
+}
+
 auto value::as_time() const -> std::optional<int64_t>
 {
     if (!is_null())
@@ -252,6 +340,16 @@ auto value::as_time() const -> std::optional<int64_t>
     return std::nullopt;
 }
 
+auto value::as_time_of_day() const -> std::optional<std::chrono::nanoseconds>
+{
+    auto time_opt = as_time();
+    if (time_opt.has_value())
+    {
+        return {from_cql_time(time_opt.value())};
+    }
+    return std::nullopt;
+}
+
 auto value::as_small_int() const -> std::optional<int16_t>
 {
     if (!is_null())
@@ -333,4 +431,8 @@ value::value(const CassValue* cass_column) : m_cass_value(cass_column)
 {
 }
 
+value::value(const CassValue* cass_column, data_type type) : m_cass_value(cass_column), m_type(type)
+{
+}
+
 } // namespace priam
@@ -0,0 +1,348 @@
+#include "priam/varint.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace priam
+{
+namespace
+{
+__extension__ typedef unsigned __int128 uint128_t;
+
+/// The largest power of 10 that fits in a 32 bit limb, the base magnitudes are converted to and from text in.
+constexpr uint32_t limb_chunk        = 1'000'000'000;
+constexpr size_t   limb_chunk_digits = 9;
+
+/// The largest power of 10 that fits in 64 bits.
+constexpr uint64_t uint64_chunk        = 10'000'000'000'000'000'000ULL;
+constexpr size_t   uint64_chunk_digits = 19;
+
+/// Every base 10 integer of up to this many digits fits in an int128_t.
+constexpr size_t int128_max_digits = 38;
+
+auto to_uint8(std::byte value) -> uint8_t
+{
+    return std::to_integer<uint8_t>(value);
+}
+
+/**
+ * Writes 'value' as exactly 'width' digits, zero padded, or as few digits as needed if 'width' is zero.
+ */
+auto append_digits(std::string& out, uint64_t value, size_t width) -> void
+{
+    char  buffer[uint64_chunk_digits + 1];
+    char* last  = buffer + sizeof(buffer);
+    char* first = last;
+    do
+    {
+        *--first = static_cast<char>('0' + value % 10);
+        value /= 10;
+    } while (value != 0);
+
+    while (static_cast<size_t>(last - first) < width)
+    {
+        *--first = '0';
+    }
+    out.append(first, last);
+}
+
+/**
+ * Writes 'value' in base 10 with 64 bit divisions for all but its top 19 digit chunks.
+ */
+auto append_uint128(std::string& out, uint128_t value) -> void
+{
+    uint64_t chunks[3];
+    size_t   count{0};
+    while (value > UINT64_MAX)
+    {
+        chunks[count++] = static_cast<uint64_t>(value % uint64_chunk);
+        value /= uint64_chunk;
+    }
+
+    append_digits(out, static_cast<uint64_t>(value), 0);
+    while (count > 0)
+    {
+        append_digits(out, chunks[--count], uint64_chunk_digits);
+    }
+}
+
+/**
+ * @param data Big endian two's complement bytes.
+ * @return The magnitude as little endian 32 bit limbs.
+ */
+auto to_magnitude(const std::byte* data, size_t size, bool negative) -> std::vector<uint32_t>
+{
+    std::vector<uint8_t> bytes(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        bytes[i] = to_uint8(data[i]);
+    }
+
+    if (negative)
+    {
+        // Two's complement negation, invert then add one.
+        bool carry = true;
+        for (size_t i = size; i > 0; --i)
+        {
+            bytes[i - 1] = static_cast<uint8_t>(~bytes[i - 1] + (carry ? 1 : 0));
+            carry        = carry && bytes[i - 1] == 0;
+        }
+    }
+
+    std::vector<uint32_t> limbs((size + 3) / 4, 0);
+    for (size_t i = 0; i < size; ++i)
+    {
+        auto shift = 8 * (i % 4);
+        limbs[i / 4] |= static_cast<uint32_t>(bytes[size - 1 - i]) << shift;
+    }
+    return limbs;
+}
+
+/**
+ * Divides the little endian limbs in place, high zero limbs are trimmed.
+ * @return The remainder.
+ */
+auto divide(std::vector<uint32_t>& limbs, uint32_t divisor) -> uint32_t
+{
+    uint64_t remainder{0};
+    for (size_t i = limbs.size(); i > 0; --i)
+    {
+        auto current = (remainder << 32) | limbs[i - 1];
+        limbs[i - 1] = static_cast<uint32_t>(current / divisor);
+        remainder    = current % divisor;
+    }
+    while (!limbs.empty() && limbs.back() == 0)
+    {
+        limbs.pop_back();
+    }
+    return static_cast<uint32_t>(remainder);
+}
+
+/**
+ * Multiplies the little endian limbs by 'multiplier' and adds 'addend' in place.
+ */
+auto multiply_add(std::vector<uint32_t>& limbs, uint32_t multiplier, uint32_t addend) -> void
+{
+    uint64_t carry{addend};
+    for (auto& limb : limbs)
+    {
+        auto current = static_cast<uint64_t>(limb) * multiplier + carry;
+        limb         = static_cast<uint32_t>(current);
+        carry        = current >> 32;
+    }
+    if (carry != 0)
+    {
+        limbs.push_back(static_cast<uint32_t>(carry));
+    }
+}
+
+} // namespace
+
+varint::varint(int64_t value) : varint(static_cast<int128_t>(value))
+{
+}
+
+varint::varint(int128_t value)
+{
+    auto      bits = static_cast<uint128_t>(value);
+    std::byte bytes[sizeof(uint128_t)];
+    for (size_t i = sizeof(bytes); i > 0; --i)
+    {
+        bytes[i - 1] = static_cast<std::byte>(bits & 0xFF);
+        bits >>= 8;
+    }
+    assign(bytes, sizeof(bytes));
+}
+
+varint::varint(const std::byte* data, size_t size)
+{
+    assign(data, size);
+}
+
+auto varint::from_string(std::string_view digits) -> std::optional<varint>
+{
+    bool negative = false;
+    if (!digits.empty() && (digits.front() == '-' || digits.front() == '+'))
+    {
+        negative = digits.front() == '-';
+        digits.remove_prefix(1);
+    }
+    if (digits.empty() || !std::all_of(digits.begin(), digits.end(), [](char c) { return c >= '0' && c <= '9'; }))
+    {
+        return std::nullopt;
+    }
+
+    if (digits.length() <= int128_max_digits)
+    {
+        uint128_t magnitude{0};
+        for (auto c : digits)
+        {
+            magnitude = magnitude * 10 + static_cast<uint128_t>(c - '0');
+        }
+        auto value = static_cast<int128_t>(magnitude);
+        return varint{negative ? -value : value};
+    }
+
+    // Accumulate 9 digit chunks into 32 bit limbs, the first chunk takes the remainder.
+    std::vector<uint32_t> limbs{};
+    size_t                chunk_length = digits.length() % limb_chunk_digits;
+    chunk_length                       = (chunk_length == 0) ? limb_chunk_digits : chunk_length;
+    while (!digits.empty())
+    {
+        uint32_t chunk{0};
+        uint32_t multiplier{1};
+        for (size_t i = 0; i < chunk_length; ++i)
+        {
+            chunk = chunk * 10 + static_cast<uint32_t>(digits[i] - '0');
+            multiplier *= 10;
+        }
+        multiply_add(limbs, multiplier, chunk);
+        digits.remove_prefix(chunk_length);
+        chunk_length = limb_chunk_digits;
+    }
+
+    // A leading zero byte leaves room for the sign bit.
+    std::vector<std::byte> bytes(limbs.size() * 4 + 1, std::byte{0});
+    for (size_t i = 0; i < limbs.size() * 4; ++i)
+    {
+        bytes[bytes.size() - 1 - i] = static_cast<std::byte>((limbs[i / 4] >> (8 * (i % 4))) & 0xFF);
+    }
+    if (negative)
+    {
+        bool carry = true;
+        for (size_t i = bytes.size(); i > 0; --i)
+        {
+            auto byte    = static_cast<uint8_t>(~to_uint8(bytes[i - 1]) + (carry ? 1 : 0));
+            carry        = carry && byte == 0;
+            bytes[i - 1] = static_cast<std::byte>(byte);
+        }
+    }
+    return varint{bytes.data(), bytes.size()};
+}
+
+auto varint::to_int64() const -> std::optional<int64_t>
+{
+    if (m_size > sizeof(int64_t))
+    {
+        return std::nullopt;
+    }
+
+    auto*    bytes = data();
+    uint64_t bits  = is_negative() ? UINT64_MAX : 0;
+    for (size_t i = 0; i < m_size; ++i)
+    {
+        bits = (bits << 8) | to_uint8(bytes[i]);
+    }
+    return static_cast<int64_t>(bits);
+}
+
+auto varint::to_int128() const -> std::optional<int128_t>
+{
+    if (m_size > sizeof(int128_t))
+    {
+        return std::nullopt;
+    }
+
+    auto*     bytes = data();
+    uint128_t bits  = is_negative() ? ~uint128_t{0} : 0;
+    for (size_t i = 0; i < m_size; ++i)
+    {
+        bits = (bits << 8) | to_uint8(bytes[i]);
+    }
+    return static_cast<int128_t>(bits);
+}
+
+auto varint::to_double() const -> double
+{
+    auto value = to_int128();
+    if (value.has_value())
+    {
+        return static_cast<double>(value.value());
+    }
+
+    auto   limbs = to_magnitude(data(), m_size, is_negative());
+    double output{0.0};
+    for (size_t i = limbs.size(); i > 0; --i)
+    {
+        output = output * 4294967296.0 + limbs[i - 1];
+    }
+    return is_negative() ? -output : output;
+}
+
+auto varint::to_string() const -> std::string
+{
+    std::string output{};
+    if (is_negative())
+    {
+        output.push_back('-');
+    }
+
+    auto value = to_int128();
+    if (value.has_value())
+    {
+        // The magnitude of the smallest value does not fit in an int128_t, negate in unsigned arithmetic.
+        auto bits = static_cast<uint128_t>(value.value());
+        append_uint128(output, is_negative() ? ~bits + 1 : bits);
+        return output;
+    }
+
+    // Peel 9 digit chunks off the magnitude from the least significant end.
+    auto                  limbs = to_magnitude(data(), m_size, is_negative());
+    std::vector<uint32_t> chunks{};
+    while (!limbs.empty())
+    {
+        chunks.push_back(divide(limbs, limb_chunk));
+    }
+
+    append_digits(output, chunks.back(), 0);
+    for (size_t i = chunks.size() - 1; i > 0; --i)
+    {
+        append_digits(output, chunks[i - 1], limb_chunk_digits);
+    }
+    return output;
+}
+
+auto varint::operator==(const varint& other) const -> bool
+{
+    return m_size == other.m_size && std::memcmp(data(), other.data(), m_size) == 0;
+}
+
+auto varint::assign(const std::byte* data, size_t size) -> void
+{
+    // A leading byte is redundant when it only repeats the sign bit of the byte after it.
+    while (size > 1)
+    {
+        auto first = to_uint8(data[0]);
+        auto next  = to_uint8(data[1]);
+        if ((first == 0x00 && (next & 0x80) == 0) || (first == 0xFF && (next & 0x80) != 0))
+        {
+            ++data;
+            --size;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // No bytes is zero, store it the same as every other zero.
+    static constexpr std::byte zero[] = {std::byte{0}};
+    if (size == 0)
+    {
+        data = zero;
+        size = 1;
+    }
+
+    m_size = size;
+    if (size <= inline_capacity)
+    {
+        std::memcpy(m_inline.data(), data, size);
+        m_heap.clear();
+    }
+    else
+    {
+        m_heap.assign(data, data + size);
+    }
+}
+
+} // namespace priam
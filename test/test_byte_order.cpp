@@ -0,0 +1,79 @@
+#include "catch.hpp"
+
+#include <priam/priam.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+TEST_CASE("big_endian_to_host integers")
+{
+    // Cover empty arrays, arrays smaller than a SIMD block and a scalar remainder after whole blocks.
+    for (size_t count : {0, 1, 7, 16, 33})
+    {
+        std::vector<uint16_t> values16{};
+        std::vector<uint32_t> values32{};
+        std::vector<uint64_t> values64{};
+        for (size_t i = 0; i < count; ++i)
+        {
+            values16.push_back(static_cast<uint16_t>(0x0102 + i));
+            values32.push_back(static_cast<uint32_t>(0x01020304 + i));
+            values64.push_back(0x0102030405060708 + i);
+        }
+
+        auto swapped16 = values16;
+        auto swapped32 = values32;
+        auto swapped64 = values64;
+        priam::big_endian_to_host(swapped16.data(), swapped16.size());
+        priam::big_endian_to_host(swapped32.data(), swapped32.size());
+        priam::big_endian_to_host(swapped64.data(), swapped64.size());
+
+        for (size_t i = 0; i < count; ++i)
+        {
+            REQUIRE(swapped16[i] == __builtin_bswap16(values16[i]));
+            REQUIRE(swapped32[i] == __builtin_bswap32(values32[i]));
+            REQUIRE(swapped64[i] == __builtin_bswap64(values64[i]));
+        }
+    }
+}
+
+TEST_CASE("big_endian_to_host floating point")
+{
+    std::vector<double> values{};
+    for (size_t i = 0; i < 9; ++i)
+    {
+        double   value = static_cast<double>(i) * 1.25;
+        uint64_t bits{0};
+        std::memcpy(&bits, &value, sizeof(bits));
+        bits = __builtin_bswap64(bits);
+        std::memcpy(&value, &bits, sizeof(bits));
+        values.push_back(value);
+    }
+
+    priam::big_endian_to_host(values.data(), values.size());
+    for (size_t i = 0; i < values.size(); ++i)
+    {
+        REQUIRE(values[i] == static_cast<double>(i) * 1.25);
+    }
+}
+
+TEST_CASE("host_to_big_endian round trips")
+{
+    std::vector<float> values{};
+    for (size_t i = 0; i < 768; ++i)
+    {
+        values.push_back(static_cast<float>(i) * 0.5f);
+    }
+
+    auto encoded = values;
+    priam::host_to_big_endian(encoded.data(), encoded.size());
+
+    uint32_t first_bits{0};
+    std::memcpy(&first_bits, &encoded[1], sizeof(first_bits));
+    uint32_t expected_bits{0};
+    std::memcpy(&expected_bits, &values[1], sizeof(expected_bits));
+    REQUIRE(first_bits == __builtin_bswap32(expected_bits));
+
+    priam::big_endian_to_host(encoded.data(), encoded.size());
+    REQUIRE(encoded == values);
+}
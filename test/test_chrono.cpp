@@ -0,0 +1,56 @@
+#include "catch.hpp"
+
+#include <priam/priam.hpp>
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("to_iso8601 formats timestamps")
+{
+    REQUIRE(priam::to_iso8601(priam::timestamp{}) == "1970-01-01T00:00:00.000Z");
+    REQUIRE(priam::to_iso8601(priam::timestamp{1577934245678ms}) == "2020-01-02T03:04:05.678Z");
+    REQUIRE(priam::to_iso8601(priam::timestamp{951782400000ms}) == "2000-02-29T00:00:00.000Z");
+    REQUIRE(priam::to_iso8601(priam::timestamp{253402300799999ms}) == "9999-12-31T23:59:59.999Z");
+}
+
+TEST_CASE("to_iso8601 formats timestamps before the epoch")
+{
+    REQUIRE(priam::to_iso8601(priam::timestamp{-1ms}) == "1969-12-31T23:59:59.999Z");
+    REQUIRE(priam::to_iso8601(priam::timestamp{-86400000ms}) == "1969-12-31T00:00:00.000Z");
+    REQUIRE(priam::to_iso8601(priam::timestamp{-62167219200000ms}) == "0000-01-01T00:00:00.000Z");
+    REQUIRE(priam::to_iso8601(priam::timestamp{-62167219200001ms}) == "-0001-12-31T23:59:59.999Z");
+}
+
+TEST_CASE("to_iso8601 formats the full 64 bit range")
+{
+    auto min = priam::to_iso8601(priam::timestamp{std::chrono::milliseconds{INT64_MIN}});
+    auto max = priam::to_iso8601(priam::timestamp{std::chrono::milliseconds{INT64_MAX}});
+
+    REQUIRE(min == "-292275055-05-16T16:47:04.192Z");
+    REQUIRE(max == "+292278994-08-17T07:12:55.807Z");
+    REQUIRE(min.length() <= priam::iso8601_max_length);
+    REQUIRE(max.length() <= priam::iso8601_max_length);
+}
+
+TEST_CASE("cql dates convert to sys_days")
+{
+    REQUIRE(priam::from_cql_date(uint32_t{1} << 31) == priam::sys_days{});
+    REQUIRE(priam::from_cql_date((uint32_t{1} << 31) - 1) == priam::sys_days{priam::days{-1}});
+    REQUIRE(priam::to_cql_date(priam::sys_days{priam::days{18263}}) == (uint32_t{1} << 31) + 18263);
+
+    for (uint32_t date : {uint32_t{0}, uint32_t{1} << 31, UINT32_MAX})
+    {
+        REQUIRE(priam::to_cql_date(priam::from_cql_date(date)) == date);
+    }
+}
+
+TEST_CASE("duration converts to chrono without months")
+{
+    REQUIRE(priam::duration{0, 1, 5}.to_chrono() == std::chrono::nanoseconds{86400000000005});
+    REQUIRE(priam::duration{0, -2, 0}.to_chrono() == std::chrono::nanoseconds{-172800000000000});
+    REQUIRE_FALSE(priam::duration{1, 0, 0}.to_chrono().has_value());
+    REQUIRE_FALSE(priam::duration{0, INT32_MAX, 0}.to_chrono().has_value());
+}
@@ -0,0 +1,51 @@
+#include "catch.hpp"
+
+#include <priam/priam.hpp>
+
+#include <array>
+#include <cstdint>
+#include <string>
+
+namespace
+{
+auto v6(std::array<uint8_t, 16> address) -> priam::inet
+{
+    return priam::inet{address.data(), address.size()};
+}
+
+} // namespace
+
+TEST_CASE("inet formats IPv4 addresses")
+{
+    std::array<uint8_t, 4> loopback{127, 0, 0, 1};
+    std::array<uint8_t, 4> broadcast{255, 255, 255, 255};
+    std::array<uint8_t, 4> mixed{10, 20, 100, 9};
+
+    REQUIRE(priam::inet{loopback.data(), loopback.size()}.is_v4());
+    REQUIRE(priam::inet{loopback.data(), loopback.size()}.to_string() == "127.0.0.1");
+    REQUIRE(priam::inet{broadcast.data(), broadcast.size()}.to_string() == "255.255.255.255");
+    REQUIRE(priam::inet{mixed.data(), mixed.size()}.to_string() == "10.20.100.9");
+}
+
+TEST_CASE("inet formats IPv6 addresses per RFC 5952")
+{
+    REQUIRE(v6({0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}).to_string() == "::1");
+    REQUIRE(v6({0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}).to_string() == "::");
+    REQUIRE(v6({0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1}).to_string() == "2001:db8::1");
+    REQUIRE(v6({0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1}).to_string() == "2001:db8:0:1::1");
+    REQUIRE(v6({0x20, 0x01, 0x0d, 0xb8, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 1}).to_string() == "2001:db8::1:0:0:1");
+    REQUIRE(v6({0x20, 0x01, 0x0d, 0xb8, 0, 1, 0, 0, 0, 1, 0, 1, 0, 1, 0, 1}).to_string() == "2001:db8:1:0:1:1:1:1");
+    REQUIRE(v6({0xfe, 0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0}).to_string() == "fe80::");
+    REQUIRE(v6({0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0xff, 0xff, 192, 0, 2, 1}).to_string() == "::ffff:192.0.2.1");
+}
+
+TEST_CASE("inet to_chars writes into a caller buffer")
+{
+    std::array<uint8_t, 16> widest{};
+    widest.fill(0xff);
+    std::array<char, priam::inet::max_string_length> buffer{};
+    auto* end = v6(widest).to_chars(buffer.data());
+    REQUIRE(std::string(buffer.data(), end) == "ffff:ffff:ffff:ffff:ffff:ffff:ffff:ffff");
+    REQUIRE(v6(widest) == v6(widest));
+    REQUIRE(v6(widest) != priam::inet{});
+}
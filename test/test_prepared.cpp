@@ -0,0 +1,346 @@
+#include "catch.hpp"
+
+#include <priam/priam.hpp>
+
+#include <atomic>
+#include <cstdio>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <thread>
+#include <vector>
+
+using namespace std::chrono_literals;
+
+static auto make_client() -> std::unique_ptr<priam::client>
+{
+    auto cluster_ptr = priam::cluster::make_unique();
+    cluster_ptr->add_host("cassandra").port(9042);
+    return std::make_unique<priam::client>(std::move(cluster_ptr), 10s);
+}
+
+static auto execute(priam::client& client, std::string_view query) -> void
+{
+    priam::statement stmt{query};
+    REQUIRE(client.execute_statement(stmt, 10s).status() == priam::status::ok);
+}
+
+TEST_CASE("prepared handles resolve to the registered prepared statement")
+{
+    auto client = make_client();
+
+    auto local   = client->prepared_register("local", "SELECT key FROM system.local");
+    auto peers   = client->prepared_register("peers", "SELECT peer FROM system.peers");
+    auto handle  = local->handle();
+    auto missing = client->prepared_find("missing");
+
+    REQUIRE(handle.valid());
+    REQUIRE(handle != peers->handle());
+    REQUIRE(client->prepared_find("local") == handle);
+    REQUIRE(client->prepared_lookup(handle) == local.get());
+    REQUIRE(client->prepared_lookup("peers") == peers);
+    REQUIRE_FALSE(missing.valid());
+    REQUIRE(client->prepared_lookup(missing) == nullptr);
+
+    // Registering a name again keeps the original name mapping.
+    auto again = client->prepared_register("local", "SELECT key FROM system.local");
+    REQUIRE_FALSE(again->handle().valid());
+    REQUIRE(client->prepared_lookup(again->handle()) == nullptr);
+    REQUIRE(client->prepared_find("local") == handle);
+}
+
+TEST_CASE("prepared lookups are safe while registering")
+{
+    auto client = make_client();
+    auto first  = client->prepared_register("first", "SELECT key FROM system.local");
+
+    // Catch assertions are not thread safe, count mismatches and check them after joining.
+    std::atomic<bool>        stop{false};
+    std::atomic<uint64_t>    mismatches{0};
+    std::vector<std::thread> readers{};
+    for (size_t i = 0; i < 4; ++i)
+    {
+        readers.emplace_back([&]() {
+            while (!stop.load(std::memory_order_relaxed))
+            {
+                if (client->prepared_lookup(first->handle()) != first.get() ||
+                    client->prepared_find("first") != first->handle())
+                {
+                    mismatches.fetch_add(1, std::memory_order_relaxed);
+                }
+            }
+        });
+    }
+
+    // Enough registrations to grow past the first chunk and name table.
+    for (size_t i = 0; i < 100; ++i)
+    {
+        auto name     = "stmt_" + std::to_string(i);
+        auto prepared = client->prepared_register(name, "SELECT key FROM system.local");
+        REQUIRE(client->prepared_find(name) == prepared->handle());
+    }
+
+    stop = true;
+    for (auto& reader : readers)
+    {
+        reader.join();
+    }
+    REQUIRE(mismatches == 0);
+}
+
+TEST_CASE("prepared register all reports each statement")
+{
+    auto client = make_client();
+
+    std::vector<priam::prepared_definition> definitions{
+        {"local", "SELECT key FROM system.local"},
+        {"invalid", "SELECT key FROM system.table_that_does_not_exist"},
+        {"peers", "SELECT peer FROM system.peers"},
+    };
+
+    auto results = client->prepared_register_all(definitions);
+    REQUIRE(results.size() == 3);
+
+    REQUIRE(results[0].name == "local");
+    REQUIRE(results[0].status == priam::status::ok);
+    REQUIRE(results[0].prepared_ptr != nullptr);
+    REQUIRE(client->prepared_lookup("local") == results[0].prepared_ptr);
+
+    REQUIRE(results[1].name == "invalid");
+    REQUIRE(results[1].status != priam::status::ok);
+    REQUIRE(results[1].prepared_ptr == nullptr);
+    REQUIRE_FALSE(results[1].error_message.empty());
+    REQUIRE(client->prepared_lookup("invalid") == nullptr);
+
+    REQUIRE(results[2].status == priam::status::ok);
+    REQUIRE(client->prepared_find("peers") == results[2].prepared_ptr->handle());
+}
+
+TEST_CASE("prepared manifest round trips through a stream")
+{
+    std::vector<priam::prepared_definition> definitions{
+        {"local", "SELECT key FROM system.local"},
+        {"escaped", "SELECT\tkey\nFROM system.local WHERE key = 'a\\\\b'"},
+        {"#hashed", "SELECT key FROM system.local"},
+    };
+
+    std::stringstream ss{};
+    priam::prepared_manifest_write(ss, definitions);
+
+    auto read = priam::prepared_manifest_read(ss);
+    REQUIRE(read.size() == 3);
+    REQUIRE(read[0].name == "local");
+    REQUIRE(read[0].query == definitions[0].query);
+    REQUIRE(read[1].name == "escaped");
+    REQUIRE(read[1].query == definitions[1].query);
+    REQUIRE(read[2].name == "#hashed");
+
+    std::vector<priam::prepared_definition> unnamed{{"", "SELECT key FROM system.local"}};
+    std::stringstream                       unnamed_ss{};
+    REQUIRE_THROWS_AS(priam::prepared_manifest_write(unnamed_ss, unnamed), std::runtime_error);
+
+    std::stringstream malformed{"# comment\n\nname without query\n"};
+    REQUIRE_THROWS_AS(priam::prepared_manifest_read(malformed), std::runtime_error);
+}
+
+TEST_CASE("prepared manifest warms a new client")
+{
+    const std::string path{"priam_prepared_manifest_test.txt"};
+    {
+        auto client = make_client();
+        client->prepared_register("local", "SELECT key FROM system.local");
+        client->prepared_register("peers", "SELECT peer FROM system.peers");
+        client->prepared_register("local", "SELECT release_version FROM system.local");
+
+        auto manifest = client->prepared_manifest();
+        REQUIRE(manifest.size() == 2);
+        REQUIRE(manifest[0].query == "SELECT key FROM system.local");
+        client->prepared_manifest_save(path);
+    }
+
+    auto client  = make_client();
+    auto results = client->prepared_manifest_load(path);
+    std::remove(path.c_str());
+
+    REQUIRE(results.size() == 2);
+    REQUIRE(results[0].status == priam::status::ok);
+    REQUIRE(results[1].status == priam::status::ok);
+    REQUIRE(client->prepared_lookup("peers")->query() == "SELECT peer FROM system.peers");
+}
+
+TEST_CASE("prepared register all reports repeated names")
+{
+    auto client  = make_client();
+    auto results = client->prepared_register_all(
+        {priam::prepared_definition{"local", "SELECT key FROM system.local"},
+         priam::prepared_definition{"local", "SELECT release_version FROM system.local"}});
+
+    REQUIRE(results.size() == 2);
+    REQUIRE(results[0].status == priam::status::ok);
+    REQUIRE(results[0].prepared_ptr != nullptr);
+    REQUIRE(results[1].status == priam::status::client_bad_params);
+    REQUIRE(results[1].prepared_ptr == nullptr);
+    REQUIRE_FALSE(results[1].error_message.empty());
+    REQUIRE(client->prepared_lookup("local")->query() == "SELECT key FROM system.local");
+    REQUIRE(client->prepared_manifest().size() == 1);
+}
+
+TEST_CASE("auto prepare prepares hot ad-hoc queries")
+{
+    auto client = make_client();
+    client->auto_prepare(16, 2);
+
+    const std::string query{"SELECT key FROM system.local"};
+    for (size_t i = 0; i < 2; ++i)
+    {
+        priam::statement statement{query};
+        REQUIRE(statement.query() == query);
+        REQUIRE(client->execute_statement(statement, 10s).status() == priam::status::ok);
+    }
+
+    // Statements with the same text share one interned copy.
+    priam::statement first{query};
+    priam::statement second{query};
+    REQUIRE(first.query().data() == second.query().data());
+
+    // The prepare runs in the background.
+    for (size_t i = 0; i < 100 && client->auto_prepared(query) == nullptr; ++i)
+    {
+        std::this_thread::sleep_for(10ms);
+    }
+    auto prepared = client->auto_prepared(query);
+    REQUIRE(prepared != nullptr);
+    REQUIRE(prepared->query() == query);
+
+    priam::statement statement{query};
+    auto             result = client->execute_statement(statement, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+    REQUIRE(result.row_count() == 1);
+    REQUIRE(client->make_statement(query).query().empty());
+
+    // Disabling evicts every query.
+    client->auto_prepare(0);
+    REQUIRE(client->auto_prepared(query) == nullptr);
+    REQUIRE(priam::statement{query}.query().empty());
+}
+
+TEST_CASE("prepared statement pool returns statements after async completion")
+{
+    auto client   = make_client();
+    auto prepared = client->prepared_register("pooled", "SELECT key FROM system.local");
+
+    {
+        auto statement = prepared->acquire_statement();
+        REQUIRE(prepared->pooled_statements() == 0);
+    }
+    REQUIRE(prepared->pooled_statements() == 1);
+
+    std::atomic<uint64_t> completed{0};
+    std::atomic<uint64_t> failed{0};
+    for (size_t i = 0; i < 16; ++i)
+    {
+        client->execute_statement(
+            prepared->acquire_statement(),
+            [&](priam::result r) {
+                if (r.status() != priam::status::ok)
+                {
+                    failed.fetch_add(1, std::memory_order_relaxed);
+                }
+                completed.fetch_add(1, std::memory_order_relaxed);
+            },
+            10s);
+    }
+
+    while (!client->empty())
+    {
+        std::this_thread::sleep_for(1ms);
+    }
+
+    REQUIRE(completed == 16);
+    REQUIRE(failed == 0);
+    REQUIRE(prepared->pooled_statements() >= 1);
+    REQUIRE(prepared->pooled_statements() <= 16);
+}
+
+TEST_CASE("prepared reads its parameter metadata")
+{
+    auto client   = make_client();
+    auto prepared = client->prepared_register(
+        "params", "SELECT key FROM system.local WHERE key = :key AND bootstrapped = ? ALLOW FILTERING");
+
+    REQUIRE(prepared->parameter_count() == 2);
+    REQUIRE(prepared->parameter_name(0) == "key");
+    REQUIRE(prepared->parameter_type(0) == priam::data_type::varchar);
+    REQUIRE(prepared->parameter_name(1) == "bootstrapped");
+
+    auto key = prepared->bind_index("key");
+    REQUIRE(key.has_value());
+    REQUIRE(key.value() == 0);
+    REQUIRE_FALSE(prepared->bind_index("missing").has_value());
+
+    auto statement = prepared->make_statement();
+    REQUIRE(statement.parameter_count() == 2);
+    REQUIRE(statement.bind_text("local", key.value()) == priam::status::ok);
+}
+
+TEST_CASE("typed prepared statements validate and decode")
+{
+    auto client = make_client();
+
+    using params_type  = std::tuple<std::string_view>;
+    using columns_type = std::tuple<std::string, std::optional<std::string>>;
+
+    auto typed = client->prepared_register<params_type, columns_type>(
+        "typed", "SELECT key, release_version FROM system.local WHERE key = ?");
+
+    auto [statement, rc] = typed.make_statement("local");
+    REQUIRE(rc == priam::status::ok);
+
+    auto result = client->execute_statement(statement, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+
+    auto rows = typed.decode(result);
+    REQUIRE(rows.size() == 1);
+    REQUIRE(std::get<0>(rows[0]) == "local");
+    REQUIRE(std::get<1>(rows[0]).has_value());
+
+    // The key is text, not an int, so the prepared statement is never registered.
+    REQUIRE_THROWS_AS(
+        client->prepared_register<std::tuple<int32_t>>("typed_bad", "SELECT key FROM system.local WHERE key = ?"),
+        std::runtime_error);
+    REQUIRE_FALSE(client->prepared_find("typed_bad").valid());
+
+    // The columns do not match the result.
+    auto mismatched = client->prepared_register<std::tuple<std::string_view>, std::tuple<int32_t>>(
+        "typed_columns", "SELECT key FROM system.local WHERE key = ?");
+    auto [columns_statement, columns_rc] = mismatched.make_statement("local");
+    REQUIRE(columns_rc == priam::status::ok);
+    auto columns_result = client->execute_statement(columns_statement, 10s);
+    REQUIRE_THROWS_AS(mismatched.decode(columns_result), std::runtime_error);
+
+    // A std::vector binds as a list, so a set parameter is rejected here rather than failing every bind.
+    execute(
+        *client,
+        "CREATE KEYSPACE IF NOT EXISTS test_prepared WITH REPLICATION = { 'class': 'SimpleStrategy', "
+        "'replication_factor': 1 }");
+    execute(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_prepared.typed (key int, values list<int>, ids set<int>, PRIMARY KEY (key))");
+
+    using collection_params_type = std::tuple<int32_t, std::optional<std::vector<int32_t>>>;
+    REQUIRE_THROWS_AS(
+        client->prepared_register<collection_params_type>(
+            "typed_set", "INSERT INTO test_prepared.typed (key, ids) VALUES (?, ?)"),
+        std::runtime_error);
+    REQUIRE_FALSE(client->prepared_find("typed_set").valid());
+
+    auto list = client->prepared_register<collection_params_type>(
+        "typed_list", "INSERT INTO test_prepared.typed (key, values) VALUES (?, ?)");
+    auto [list_statement, list_rc] = list.make_statement(1, std::vector<int32_t>{1, 2});
+    REQUIRE(list_rc == priam::status::ok);
+    REQUIRE(client->execute_statement(list_statement, 10s).status() == priam::status::ok);
+
+    execute(*client, "DROP KEYSPACE IF EXISTS test_prepared");
+}
@@ -0,0 +1,66 @@
+#include "catch.hpp"
+
+#include <priam/priam.hpp>
+
+#include <ranges>
+#include <string>
+
+using namespace std::chrono_literals;
+
+static_assert(std::ranges::input_range<priam::result>);
+static_assert(std::ranges::input_range<priam::row>);
+
+static auto execute(priam::client& client, std::string_view query) -> void
+{
+    priam::statement stmt{query};
+    REQUIRE(client.execute_statement(stmt, 10s).status() == priam::status::ok);
+}
+
+TEST_CASE("ranges views over rows and columns")
+{
+    auto cluster_ptr = priam::cluster::make_unique();
+    cluster_ptr->add_host("cassandra").port(9042);
+    priam::client client{std::move(cluster_ptr), 10s};
+
+    execute(client, "DROP KEYSPACE IF EXISTS test_ranges");
+    execute(
+        client,
+        "CREATE KEYSPACE IF NOT EXISTS test_ranges WITH REPLICATION = { 'class': 'SimpleStrategy', "
+        "'replication_factor': 1 }");
+    execute(client, "CREATE TABLE IF NOT EXISTS test_ranges.rows (key int, name text, PRIMARY KEY (key))");
+
+    for (int32_t i = 0; i < 10; ++i)
+    {
+        priam::statement insert{"INSERT INTO test_ranges.rows (key, name) VALUES (?, ?)"};
+        REQUIRE(insert.bind_int(i, 0) == priam::status::ok);
+        if (i % 2 == 0)
+        {
+            REQUIRE(insert.bind_text("name" + std::to_string(i), 1) == priam::status::ok);
+        }
+        REQUIRE(client.execute_statement(insert, 10s).status() == priam::status::ok);
+    }
+
+    priam::statement select{"SELECT key, name FROM test_ranges.rows"};
+    auto             result = client.execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+
+    auto names = result | std::views::filter([](const priam::row& row) { return !row.column("name").is_null(); }) |
+                 std::views::transform([](const priam::row& row) { return row.column("key").as_int().value(); });
+    int32_t sum{0};
+    for (auto key : names)
+    {
+        REQUIRE(key % 2 == 0);
+        sum += key;
+    }
+    REQUIRE(sum == 0 + 2 + 4 + 6 + 8);
+
+    auto reread = client.execute_statement(select, 10s);
+    REQUIRE(reread.status() == priam::status::ok);
+    for (const auto& row : reread)
+    {
+        auto non_null = row | std::views::filter([](const priam::value& value) { return !value.is_null(); });
+        REQUIRE(std::ranges::distance(non_null) == (row.column("key").as_int().value() % 2 == 0 ? 2 : 1));
+    }
+
+    execute(client, "DROP KEYSPACE IF EXISTS test_ranges");
+}
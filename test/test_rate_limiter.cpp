@@ -0,0 +1,106 @@
+#include "catch.hpp"
+
+#include <priam/priam.hpp>
+
+#include <atomic>
+#include <thread>
+
+using namespace std::chrono_literals;
+
+TEST_CASE("token_bucket unlimited")
+{
+    priam::token_bucket bucket{};
+
+    REQUIRE(bucket.unlimited());
+    for (size_t i = 0; i < 1'000; ++i)
+    {
+        REQUIRE(bucket.try_acquire(1'000'000.0));
+    }
+}
+
+TEST_CASE("token_bucket refills at the rate")
+{
+    auto                now = priam::token_bucket::clock::now();
+    priam::token_bucket bucket{};
+    bucket.rate(10.0, 10.0, now);
+
+    // The bucket has no tokens after changing from unlimited, wait for a full refill.
+    now += 2s;
+    for (size_t i = 0; i < 10; ++i)
+    {
+        REQUIRE(bucket.try_acquire(1.0, now));
+    }
+    REQUIRE_FALSE(bucket.try_acquire(1.0, now));
+    REQUIRE(bucket.wait_time(1.0, now) > 0ns);
+    REQUIRE(bucket.wait_time(1.0, now) <= 100ms + 1ns);
+
+    now += 110ms;
+    REQUIRE(bucket.try_acquire(1.0, now));
+    REQUIRE_FALSE(bucket.try_acquire(1.0, now));
+}
+
+TEST_CASE("token_bucket request larger than burst goes into debt")
+{
+    auto                now = priam::token_bucket::clock::now();
+    priam::token_bucket bucket{};
+    bucket.rate(100.0, 100.0, now);
+    now += 2s;
+
+    // A 300 token request is allowed on a full bucket and then must be paid back.
+    REQUIRE(bucket.try_acquire(300.0, now));
+    REQUIRE_FALSE(bucket.try_acquire(1.0, now + 2s));
+    REQUIRE(bucket.try_acquire(1.0, now + 2s + 20ms));
+}
+
+TEST_CASE("token_bucket rate can be lowered at runtime")
+{
+    auto                now = priam::token_bucket::clock::now();
+    priam::token_bucket bucket{};
+    bucket.rate(1'000.0, 1'000.0, now);
+    now += 2s;
+
+    bucket.rate(1.0, 1.0, now);
+    REQUIRE(bucket.rate() == 1.0);
+    REQUIRE(bucket.burst() == 1.0);
+    REQUIRE(bucket.try_acquire(1.0, now));
+    REQUIRE_FALSE(bucket.try_acquire(1.0, now));
+    REQUIRE(bucket.try_acquire(1.0, now + 1s));
+}
+
+TEST_CASE("rate_limited_client cancels queued statements on shutdown")
+{
+    auto cluster_ptr = priam::cluster::make_unique();
+    cluster_ptr->add_host("cassandra").port(9042);
+    priam::client client{std::move(cluster_ptr), 10s};
+
+    std::atomic<size_t> executed{0};
+    std::atomic<size_t> cancelled{0};
+    auto                on_complete = [&](priam::result result) {
+        if (result.status() == priam::status::client_request_timed_out)
+        {
+            ++cancelled;
+        }
+        else
+        {
+            ++executed;
+        }
+    };
+
+    {
+        // One statement per ten seconds, only the first is sent before the rate limited client is destroyed.
+        priam::rate_limited_client limiter{client, 0.1};
+        limiter.requests_per_second(0.1, 1.0);
+        for (size_t i = 0; i < 10; ++i)
+        {
+            limiter.execute_statement(priam::statement{"SELECT key FROM system.local"}, on_complete, 10s);
+        }
+        REQUIRE(limiter.queued() == 9);
+        REQUIRE_FALSE(limiter.drain(100ms));
+    }
+
+    REQUIRE(cancelled == 9);
+    while (executed != 1)
+    {
+        std::this_thread::sleep_for(10ms);
+    }
+}
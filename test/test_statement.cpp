@@ -0,0 +1,62 @@
+#include "catch.hpp"
+
+#include <priam/priam.hpp>
+
+#include <array>
+#include <chrono>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+TEST_CASE("statement counts positional bind markers")
+{
+    REQUIRE(priam::statement{"SELECT key FROM system.local"}.parameter_count() == 0);
+    REQUIRE(priam::statement{"INSERT INTO ks.t (a, b, c) VALUES (?, ?, ?)"}.parameter_count() == 3);
+}
+
+TEST_CASE("statement counts distinct named bind markers")
+{
+    priam::statement statement{"SELECT * FROM ks.t WHERE a = :a AND b = :b_2 AND c IN (:a, ?)"};
+    REQUIRE(statement.parameter_count() == 3);
+
+    // Map literals and casts are not named markers.
+    REQUIRE(priam::statement{"UPDATE ks.t SET m = {'k':1} WHERE a = ?"}.parameter_count() == 1);
+}
+
+TEST_CASE("statement ignores bind markers in literals and comments")
+{
+    priam::statement literals{"SELECT * FROM ks.t WHERE a = 'why?' AND b = 'it''s :b?' AND \"c?\" = ?"};
+    REQUIRE(literals.parameter_count() == 1);
+
+    priam::statement dollar{"INSERT INTO ks.t (a, b) VALUES ($$ :a ? $$, ?)"};
+    REQUIRE(dollar.parameter_count() == 1);
+
+    priam::statement comments{"SELECT * -- what?\nFROM ks.t /* :a ? */ WHERE a = ? // b?"};
+    REQUIRE(comments.parameter_count() == 1);
+}
+
+TEST_CASE("statement bind_all binds each C++ type")
+{
+    static_assert(priam::is_list_range<std::vector<int32_t>>::value);
+    static_assert(priam::is_list_range<std::array<double, 3>>::value);
+    static_assert(!priam::is_list_range<std::string>::value);
+    static_assert(!priam::is_list_range<std::string_view>::value);
+
+    priam::statement statement{"INSERT INTO ks.t (a, b, c, d, e, f, g, h, i, j) VALUES (?, ?, ?, ?, ?, ?, ?, ?, ?, ?)"};
+
+    std::string           text{"text"};
+    std::optional<int8_t> missing{};
+    std::vector<int32_t>  list{1, 2, 3};
+    priam::uuid           uuid{};
+    auto                  now = std::chrono::system_clock::now();
+
+    REQUIRE(
+        statement.bind_all(
+            true, int64_t{1}, 2.0, text, std::string_view{"view"}, "literal", missing, list, uuid, now) ==
+        priam::status::ok);
+
+    // There are only 10 parameters.
+    REQUIRE(statement.bind(int32_t{1}, 10) != priam::status::ok);
+    REQUIRE(statement.bind(std::optional<int32_t>{7}, 0) == priam::status::ok);
+}
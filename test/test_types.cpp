@@ -2,7 +2,15 @@
 
 #include <priam/priam.hpp>
 
+#include <array>
+#include <atomic>
 #include <iostream>
+#include <memory_resource>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
 
 using namespace std::chrono_literals;
 
@@ -29,22 +37,32 @@ static auto create_table(priam::client& client, std::string_view query) -> void
     REQUIRE(result.status() == priam::status::ok);
 }
 
-TEST_CASE("type boolean")
+/**
+ * Connects to the test cluster and recreates an empty test_types keyspace.
+ */
+static auto make_client() -> std::unique_ptr<priam::client>
 {
     auto cluster_ptr = priam::cluster::make_unique();
     cluster_ptr->add_host("cassandra").port(9042);
-    priam::client client{std::move(cluster_ptr), 10s};
+    auto client = std::make_unique<priam::client>(std::move(cluster_ptr), 10s);
+
+    drop_keyspace(*client);
+    create_keyspace(*client);
+    return client;
+}
+
+TEST_CASE("type boolean")
+{
+    auto client = make_client();
 
-    drop_keyspace(client);
-    create_keyspace(client);
     create_table(
-        client, "CREATE TABLE IF NOT EXISTS test_types.test_boolean (key int, value boolean, PRIMARY KEY (key))");
+        *client, "CREATE TABLE IF NOT EXISTS test_types.test_boolean (key int, value boolean, PRIMARY KEY (key))");
 
     priam::statement insert{"INSERT INTO test_types.test_boolean (key, value) VALUES (?, ?)"};
     auto             insert_func = [&](int key, bool value) -> void {
         REQUIRE(insert.bind_int(key, 0) == priam::status::ok);
         REQUIRE(insert.bind_boolean(value, 1) == priam::status::ok);
-        auto result = client.execute_statement(insert);
+        auto result = client->execute_statement(insert);
         REQUIRE(result.status() == priam::status::ok);
         insert.reset();
     };
@@ -58,7 +76,7 @@ TEST_CASE("type boolean")
     priam::statement select{"SELECT key, value FROM test_types.test_boolean WHERE key = ?"};
     auto             select_func = [&](int key, std::optional<bool> expected_value) -> void {
         select.bind_int(key, 0);
-        auto result = client.execute_statement(select);
+        auto result = client->execute_statement(select);
         REQUIRE(result.status() == priam::status::ok);
 
         result.for_each([&](const priam::row& row) {
@@ -93,7 +111,7 @@ TEST_CASE("type boolean")
 
     {
         priam::statement select_all{"SELECT key, value FROM test_types.test_boolean WHERE key IN (1, 2, 3, 4, 5, 6)"};
-        auto             result = client.execute_statement(select_all);
+        auto             result = client->execute_statement(select_all);
         REQUIRE(result.status() == priam::status::ok);
 
         for (const auto& row : result)
@@ -168,4 +186,800 @@ TEST_CASE("type boolean")
             }
         }
     }
-}
\ No newline at end of file
+}
+
+struct mapped_boolean
+{
+    int32_t             key{0};
+    std::optional<bool> value{};
+};
+
+namespace priam
+{
+template<>
+struct mapping<mapped_boolean>
+{
+    static constexpr auto fields =
+        std::make_tuple(priam::field("value", &mapped_boolean::value), priam::field("key", &mapped_boolean::key));
+};
+} // namespace priam
+
+TEST_CASE("result as mapped struct")
+{
+    auto client = make_client();
+
+    create_table(
+        *client, "CREATE TABLE IF NOT EXISTS test_types.test_mapped (key int, value boolean, PRIMARY KEY (key))");
+
+    priam::statement insert{"INSERT INTO test_types.test_mapped (key, value) VALUES (?, ?)"};
+    REQUIRE(insert.bind_all(int32_t{1}, true) == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+    insert.reset();
+    REQUIRE(insert.bind_all(int32_t{2}, std::nullopt) == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+    priam::statement select{"SELECT key, value FROM test_types.test_mapped"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+
+    auto rows = result.as<mapped_boolean>();
+    REQUIRE(rows.size() == 2);
+    for (const auto& row : rows)
+    {
+        if (row.key == 1)
+        {
+            REQUIRE(row.value == std::optional<bool>{true});
+        }
+        else
+        {
+            REQUIRE(row.key == 2);
+            REQUIRE_FALSE(row.value.has_value());
+        }
+    }
+
+    priam::statement missing{"SELECT key FROM test_types.test_mapped"};
+    auto             missing_result = client->execute_statement(missing, 10s);
+    REQUIRE_THROWS_AS(missing_result.as<mapped_boolean>(), std::runtime_error);
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("result column handles")
+{
+    auto client = make_client();
+
+    create_table(
+        *client, "CREATE TABLE IF NOT EXISTS test_types.test_handles (key int, value boolean, PRIMARY KEY (key))");
+
+    priam::statement insert{"INSERT INTO test_types.test_handles (key, value) VALUES (?, ?)"};
+    REQUIRE(insert.bind_all(int32_t{1}, true) == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+    priam::statement select{"SELECT key, value FROM test_types.test_handles"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+
+    REQUIRE(result.columns().size() == 2);
+    REQUIRE(result.columns()[0].name() == "key");
+    REQUIRE(result.columns()[0].type() == priam::data_type::int_t);
+    REQUIRE(result.column_index("value") == std::optional<size_t>{1});
+    REQUIRE_FALSE(result.column_index("missing").has_value());
+    REQUIRE_THROWS_AS(result.column("missing"), std::runtime_error);
+
+    const auto& value_column = result.column("value");
+    REQUIRE(value_column.index() == 1);
+    REQUIRE(value_column.type() == priam::data_type::boolean);
+
+    result.for_each([&](const priam::row& row) {
+        auto value = row[value_column];
+        REQUIRE(value.is<priam::data_type::boolean>());
+        REQUIRE(value.as_boolean() == std::optional<bool>{true});
+    });
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("result column views")
+{
+    auto client = make_client();
+
+    create_table(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_types.test_column_views (key int, amount bigint, label text, "
+        "PRIMARY KEY (key))");
+
+    constexpr int32_t rows = 20;
+    for (int32_t key = 0; key < rows; ++key)
+    {
+        priam::statement insert{"INSERT INTO test_types.test_column_views (key, amount, label) VALUES (?, ?, ?)"};
+        if (key % 4 == 0)
+        {
+            REQUIRE(insert.bind_all(key, std::nullopt, std::nullopt) == priam::status::ok);
+        }
+        else
+        {
+            REQUIRE(insert.bind_all(key, int64_t{key} * 1000, (key % 2 == 0) ? "even" : "odd") == priam::status::ok);
+        }
+        REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+    }
+
+    priam::statement select{"SELECT key, amount, label FROM test_types.test_column_views"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+    REQUIRE(result.row_count() == rows);
+
+    auto keys    = result.column_view<int32_t>("key");
+    auto amounts = result.column_view<int64_t>("amount");
+    auto labels  = result.column_view<std::string_view>("label");
+    REQUIRE(keys.null_count() == 0);
+    REQUIRE(amounts.null_count() == rows / 4);
+    REQUIRE(labels.null_count() == rows / 4);
+    REQUIRE(labels.dictionary().size() == 2);
+
+    for (size_t row = 0; row < result.row_count(); ++row)
+    {
+        auto key = keys[row];
+        if (key % 4 == 0)
+        {
+            REQUIRE_FALSE(amounts.valid(row));
+            REQUIRE(amounts[row] == 0);
+            REQUIRE_FALSE(labels.valid(row));
+        }
+        else
+        {
+            REQUIRE(amounts[row] == int64_t{key} * 1000);
+            REQUIRE(labels[row] == ((key % 2 == 0) ? "even" : "odd"));
+        }
+    }
+
+    REQUIRE_THROWS_AS(result.column_view<int32_t>("label"), std::runtime_error);
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("result arrow export")
+{
+    auto client = make_client();
+
+    create_table(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_types.test_arrow (key int, label text, tags list<int>, PRIMARY KEY (key))");
+
+    constexpr int32_t rows = 10;
+    for (int32_t key = 0; key < rows; ++key)
+    {
+        priam::statement insert{"INSERT INTO test_types.test_arrow (key, label, tags) VALUES (?, ?, ?)"};
+        REQUIRE(insert.bind_all(key, std::nullopt, std::vector<int32_t>{key, key}) == priam::status::ok);
+        REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+    }
+
+    priam::statement select{"SELECT key, label, tags FROM test_types.test_arrow"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+
+    ArrowSchema schema{};
+    priam::arrow_export_schema(result, &schema);
+    REQUIRE(std::string_view{schema.format} == "+s");
+    REQUIRE(schema.n_children == 3);
+    REQUIRE(std::string_view{schema.children[0]->name} == "key");
+    REQUIRE(std::string_view{schema.children[0]->format} == "i");
+    REQUIRE(std::string_view{schema.children[1]->format} == "u");
+    REQUIRE(std::string_view{schema.children[2]->format} == "+l");
+    REQUIRE(std::string_view{schema.children[2]->children[0]->format} == "i");
+    schema.release(&schema);
+    REQUIRE(schema.release == nullptr);
+
+    ArrowArray array{};
+    priam::arrow_export_array(result, &array);
+    REQUIRE(array.length == rows);
+    REQUIRE(array.n_children == 3);
+
+    const auto* keys = static_cast<const int32_t*>(array.children[0]->buffers[1]);
+    const auto* tags = array.children[2];
+    REQUIRE(array.children[1]->null_count == rows);
+    REQUIRE(tags->children[0]->length == rows * 2);
+    const auto* tag_values = static_cast<const int32_t*>(tags->children[0]->buffers[1]);
+    for (int64_t row = 0; row < rows; ++row)
+    {
+        REQUIRE(tag_values[row * 2] == keys[row]);
+    }
+    array.release(&array);
+
+    // Two pages of the same query as a stream.
+    size_t           pages{0};
+    ArrowArrayStream stream{};
+    priam::arrow_export_stream(
+        [&]() -> std::optional<priam::result> {
+            if (pages++ < 2)
+            {
+                return client->execute_statement(select, 10s);
+            }
+            return std::nullopt;
+        },
+        &stream);
+
+    size_t batches{0};
+    while (true)
+    {
+        ArrowArray batch{};
+        REQUIRE(stream.get_next(&stream, &batch) == 0);
+        if (batch.release == nullptr)
+        {
+            break;
+        }
+        REQUIRE(batch.length == rows);
+        batch.release(&batch);
+        ++batches;
+    }
+    REQUIRE(batches == 2);
+    stream.release(&stream);
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("type text and inet views")
+{
+    auto client = make_client();
+
+    create_table(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_types.test_views (key int, label text, address inet, PRIMARY KEY (key))");
+
+    auto address = priam::inet::from_string("2001:db8::1");
+    REQUIRE(address.has_value());
+
+    priam::statement insert{"INSERT INTO test_types.test_views (key, label, address) VALUES (?, ?, ?)"};
+    REQUIRE(insert.bind_all(int32_t{1}, "borrowed", address.value()) == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+    priam::statement select{"SELECT label, address FROM test_types.test_views WHERE key = 1"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+    REQUIRE(result.row_count() == 1);
+
+    auto row = result.first_row();
+    REQUIRE(row.column("label").as_text_view() == std::optional<std::string_view>{"borrowed"});
+
+    std::string label{};
+    label.reserve(64);
+    REQUIRE(row.column("label").as_text(label));
+    REQUIRE(label == "borrowed");
+    REQUIRE(label.capacity() >= 64);
+
+    auto inet = row.column("address").as_inet();
+    REQUIRE(inet.has_value());
+    REQUIRE(inet.value().is_v6());
+    REQUIRE(inet.value() == address.value());
+    REQUIRE(inet.value().to_string() == "2001:db8::1");
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("type timestamp")
+{
+    auto client = make_client();
+
+    create_table(
+        *client, "CREATE TABLE IF NOT EXISTS test_types.test_timestamp (key int, value timestamp, PRIMARY KEY (key))");
+
+    // Past 2038 and before the epoch, neither fits in 32 bits of seconds.
+    priam::timestamp future{4102444800123ms};
+    priam::timestamp past{-1ms};
+
+    priam::statement insert{"INSERT INTO test_types.test_timestamp (key, value) VALUES (?, ?)"};
+    REQUIRE(insert.bind_all(int32_t{1}, future) == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+    insert.reset();
+    REQUIRE(insert.bind_all(int32_t{2}, past) == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+    priam::statement select{"SELECT key, value FROM test_types.test_timestamp"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+    REQUIRE(result.row_count() == 2);
+
+    result.for_each([&](const priam::row& row) {
+        auto value = row.column("value");
+        if (row.column("key").as_int() == std::optional<int32_t>{1})
+        {
+            REQUIRE(value.as_timestamp() == std::optional<priam::timestamp>{future});
+            REQUIRE(value.as_timestamp_date_formatted().value() == "2100-01-01T00:00:00.123Z");
+        }
+        else
+        {
+            REQUIRE(value.as_timestamp() == std::optional<priam::timestamp>{past});
+            REQUIRE(value.as_timestamp_date_formatted().value() == "1969-12-31T23:59:59.999Z");
+        }
+    });
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("type varint and decimal")
+{
+    auto client = make_client();
+
+    create_table(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_types.test_numeric (key int, big varint, price decimal, PRIMARY KEY (key))");
+
+    auto big   = priam::varint::from_string("-123456789012345678901234567890123456789012345678901234567890");
+    auto price = priam::decimal::from_string("12345678901234567890.000123");
+    REQUIRE(big.has_value());
+    REQUIRE(price.has_value());
+
+    priam::statement insert{"INSERT INTO test_types.test_numeric (key, big, price) VALUES (?, ?, ?)"};
+    REQUIRE(insert.bind_int(1, 0) == priam::status::ok);
+    REQUIRE(insert.bind_varint(big.value(), 1) == priam::status::ok);
+    REQUIRE(insert.bind_decimal(price.value(), 2) == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+    priam::statement select{"SELECT big, price FROM test_types.test_numeric WHERE key = 1"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+    REQUIRE(result.row_count() == 1);
+
+    auto row = result.first_row();
+    REQUIRE(row.column("big").as_varint() == big);
+    REQUIRE(row.column("price").as_decimal() == price);
+    REQUIRE(row.column("price").as_decimal().value().to_string() == "12345678901234567890.000123");
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("type collections bulk decode")
+{
+    auto client = make_client();
+
+    create_table(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_types.test_collections (key int, values list<bigint>, ids set<int>, "
+        "weights map<int, double>, names list<text>, PRIMARY KEY (key))");
+
+    priam::statement insert{
+        "INSERT INTO test_types.test_collections (key, values, ids, weights, names) VALUES "
+        "(1, [-1, 0, 9223372036854775807], {3, 1, 2}, {1: 0.5, 2: -2.25}, ['a', 'bc'])"};
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+    priam::statement select{"SELECT values, ids, weights, names FROM test_types.test_collections WHERE key = 1"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+    REQUIRE(result.row_count() == 1);
+
+    auto row = result.first_row();
+    REQUIRE(row.column("values").as_list<int64_t>() == std::vector<int64_t>{-1, 0, INT64_MAX});
+    REQUIRE(row.column("ids").as_set<int32_t>() == std::vector<int32_t>{1, 2, 3});
+
+    auto weights = row.column("weights").as_map<int32_t, double>();
+    REQUIRE(weights.has_value());
+    REQUIRE(weights.value().size() == 2);
+    REQUIRE(weights.value().at(1) == 0.5);
+    REQUIRE(weights.value().at(2) == -2.25);
+
+    REQUIRE(row.column("names").as_list<std::string>() == std::vector<std::string>{"a", "bc"});
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("type ranges bind to lists and decode from lists and sets")
+{
+    auto client = make_client();
+
+    create_table(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_types.test_range_binds (key int, values list<int>, ids set<int>, "
+        "PRIMARY KEY (key))");
+
+    using params_type = std::tuple<int32_t, std::vector<int32_t>>;
+
+    auto insert_values = client->prepared_register<params_type>(
+        "range_list", "INSERT INTO test_types.test_range_binds (key, values) VALUES (?, ?)");
+    auto [insert, rc] = insert_values.make_statement(1, std::vector<int32_t>{3, 1, 2});
+    REQUIRE(rc == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+    // A range always binds as a list, so binding it to a set is rejected when registering.
+    REQUIRE_THROWS_AS(
+        client->prepared_register<params_type>(
+            "range_set", "INSERT INTO test_types.test_range_binds (key, ids) VALUES (?, ?)"),
+        std::runtime_error);
+    REQUIRE_FALSE(client->prepared_find("range_set").valid());
+
+    priam::statement update{"UPDATE test_types.test_range_binds SET ids = {3, 1, 2} WHERE key = 1"};
+    REQUIRE(client->execute_statement(update, 10s).status() == priam::status::ok);
+
+    using columns_type = std::tuple<std::vector<int32_t>, std::vector<int32_t>>;
+    auto select        = client->prepared_register<std::tuple<int32_t>, columns_type>(
+        "range_select", "SELECT values, ids FROM test_types.test_range_binds WHERE key = ?");
+    auto [select_statement, select_rc] = select.make_statement(1);
+    REQUIRE(select_rc == priam::status::ok);
+    auto rows = select.decode(client->execute_statement(select_statement, 10s));
+    REQUIRE(rows.size() == 1);
+    REQUIRE(std::get<0>(rows[0]) == std::vector<int32_t>{3, 1, 2});
+    REQUIRE(std::get<1>(rows[0]) == std::vector<int32_t>{1, 2, 3});
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("type collection builders")
+{
+    auto client = make_client();
+
+    create_table(*client, "CREATE TYPE IF NOT EXISTS test_types.address (street text, number int)");
+    create_table(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_types.test_builders (key int, ids set<int>, counts map<text, bigint>, "
+        "pair tuple<int, text>, home frozen<address>, PRIMARY KEY (key))");
+
+    auto prepared = client->prepared_register(
+        "insert_builders",
+        "INSERT INTO test_types.test_builders (key, ids, counts, pair, home) VALUES (?, ?, ?, ?, ?)");
+
+    std::vector<int32_t> ids(1000);
+    for (size_t i = 0; i < ids.size(); ++i)
+    {
+        ids[i] = static_cast<int32_t>(ids.size() - i);
+    }
+    priam::statement_set set{ids.size()};
+    REQUIRE(set.append_range(ids));
+
+    std::string keys[]   = {"a", "b"};
+    int64_t     values[] = {1, 2};
+    priam::statement_map map{2};
+    REQUIRE(map.append_range(keys, values, 2));
+
+    priam::statement_tuple tuple{2};
+    REQUIRE(tuple.append(int32_t{7}));
+    REQUIRE(tuple.append(std::string_view{"seven"}));
+
+    priam::statement_user_type home{prepared->parameter_data_type(4)};
+    REQUIRE(home.set("street", std::string_view{"Main"}));
+    REQUIRE(home.set("number", int32_t{42}));
+
+    auto insert = prepared->make_statement();
+    REQUIRE(insert.bind_int(1, 0) == priam::status::ok);
+    REQUIRE(insert.bind_set(std::move(set), 1) == priam::status::ok);
+    REQUIRE(insert.bind_map(std::move(map), "counts") == priam::status::ok);
+    REQUIRE(insert.bind_tuple(std::move(tuple), 3) == priam::status::ok);
+    REQUIRE(insert.bind_user_type(std::move(home), 4) == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+    priam::statement select{
+        "SELECT ids, counts, pair, home.street, home.number FROM test_types.test_builders WHERE key = 1"};
+    auto result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+    REQUIRE(result.row_count() == 1);
+
+    auto row     = result.first_row();
+    auto set_ids = row.column("ids").as_set<int32_t>();
+    REQUIRE(set_ids.has_value());
+    REQUIRE(set_ids.value().size() == 1000);
+    REQUIRE(set_ids.value().front() == 1);
+    REQUIRE(set_ids.value().back() == 1000);
+
+    auto counts = row.column("counts").as_map<std::string, int64_t>();
+    REQUIRE(counts.has_value());
+    REQUIRE(counts.value().at("a") == 1);
+    REQUIRE(counts.value().at("b") == 2);
+
+    std::vector<priam::data_type> pair{};
+    row.column("pair").as_tuple().value().for_each(
+        [&](const priam::value& element) { pair.push_back(element.type()); });
+    REQUIRE(pair == std::vector<priam::data_type>{priam::data_type::int_t, priam::data_type::varchar});
+
+    REQUIRE(row.column(size_t{3}).as_text() == "Main");
+    REQUIRE(row.column(size_t{4}).as_int() == 42);
+
+    drop_keyspace(*client);
+}
+
+struct mapped_address
+{
+    std::string street{};
+    int32_t     number{0};
+};
+
+struct mapped_owner
+{
+    std::string    name{};
+    mapped_address home{};
+};
+
+namespace priam
+{
+template<>
+struct mapping<mapped_address>
+{
+    static constexpr auto fields = std::make_tuple(
+        priam::field("street", &mapped_address::street), priam::field("number", &mapped_address::number));
+};
+
+template<>
+struct mapping<mapped_owner>
+{
+    static constexpr auto fields =
+        std::make_tuple(priam::field("name", &mapped_owner::name), priam::field("home", &mapped_owner::home));
+};
+} // namespace priam
+
+TEST_CASE("type user defined type mapping")
+{
+    auto client = make_client();
+
+    create_table(*client, "CREATE TYPE IF NOT EXISTS test_types.address (number int, street text, unit text)");
+    create_table(*client, "CREATE TYPE IF NOT EXISTS test_types.owner (name text, home frozen<address>)");
+    create_table(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_types.test_udt (key int, owner frozen<owner>, "
+        "previous list<frozen<address>>, PRIMARY KEY (key))");
+
+    auto prepared = client->prepared_register(
+        "insert_udt", "INSERT INTO test_types.test_udt (key, owner, previous) VALUES (?, ?, ?)");
+
+    mapped_owner owner{"Ann", mapped_address{"Main", 42}};
+    priam::statement_user_type owner_type{prepared->parameter_data_type(1)};
+    REQUIRE(owner_type.set_all(owner));
+
+    auto*                 address_type = cass_data_type_sub_data_type(prepared->parameter_data_type(2), 0);
+    priam::statement_list previous{2};
+    for (const auto& address : {mapped_address{"Elm", 1}, mapped_address{"Oak", 2}})
+    {
+        priam::statement_user_type previous_type{address_type};
+        REQUIRE(previous_type.set_all(address));
+        REQUIRE(previous.append_user_type(std::move(previous_type)));
+    }
+
+    auto insert = prepared->make_statement();
+    REQUIRE(insert.bind_int(1, 0) == priam::status::ok);
+    REQUIRE(insert.bind_user_type(std::move(owner_type), 1) == priam::status::ok);
+    REQUIRE(insert.bind_list(std::move(previous), 2) == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+    priam::statement select{"SELECT owner, previous FROM test_types.test_udt WHERE key = 1"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+    REQUIRE(result.row_count() == 1);
+
+    auto row     = result.first_row();
+    auto decoded = row.column("owner").as_udt<mapped_owner>();
+    REQUIRE(decoded.has_value());
+    REQUIRE(decoded.value().name == "Ann");
+    REQUIRE(decoded.value().home.street == "Main");
+    REQUIRE(decoded.value().home.number == 42);
+
+    auto addresses = row.column("previous").as_list<mapped_address>();
+    REQUIRE(addresses.has_value());
+    REQUIRE(addresses.value().size() == 2);
+    REQUIRE(addresses.value()[0].street == "Elm");
+    REQUIRE(addresses.value()[1].number == 2);
+
+    drop_keyspace(*client);
+}
+
+struct mapped_scores
+{
+    std::vector<int32_t> scores{};
+};
+
+namespace priam
+{
+template<>
+struct mapping<mapped_scores>
+{
+    static constexpr auto fields = std::make_tuple(priam::field("scores", &mapped_scores::scores));
+};
+} // namespace priam
+
+TEST_CASE("type user defined type mapping checks nested field types")
+{
+    auto client = make_client();
+
+    // The same type is created twice, only the element type of its list field differs.
+    for (const auto* element_type : {"int", "text"})
+    {
+        drop_keyspace(*client);
+        create_keyspace(*client);
+        create_table(
+            *client, "CREATE TYPE IF NOT EXISTS test_types.scores (scores list<" + std::string{element_type} + ">)");
+        create_table(
+            *client,
+            "CREATE TABLE IF NOT EXISTS test_types.test_scores (key int, value frozen<scores>, PRIMARY KEY (key))");
+
+        std::string values = (std::string_view{element_type} == "int") ? "[1, 2]" : "['a', 'b']";
+        priam::statement insert{
+            "INSERT INTO test_types.test_scores (key, value) VALUES (1, {scores: " + values + "})"};
+        REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+        priam::statement select{"SELECT value FROM test_types.test_scores WHERE key = 1"};
+        auto             result = client->execute_statement(select, 10s);
+        REQUIRE(result.status() == priam::status::ok);
+        auto row = result.first_row();
+        if (std::string_view{element_type} == "int")
+        {
+            REQUIRE(row.column("value").as_udt<mapped_scores>().value().scores == std::vector<int32_t>{1, 2});
+        }
+        else
+        {
+            // The layout cached for list<int> must not be reused for list<text>.
+            REQUIRE_THROWS_AS(row.column("value").as_udt<mapped_scores>(), std::runtime_error);
+        }
+    }
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("type detached result")
+{
+    auto client = make_client();
+
+    create_table(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_types.test_detached (key int, total bigint, name text, PRIMARY KEY (key))");
+
+    for (int32_t i = 0; i < 10; ++i)
+    {
+        priam::statement insert{"INSERT INTO test_types.test_detached (key, total, name) VALUES (?, ?, ?)"};
+        REQUIRE(insert.bind_int(i, 0) == priam::status::ok);
+        REQUIRE(insert.bind_big_int(int64_t{i} * 1'000'000'000'000, 1) == priam::status::ok);
+        if (i % 2 == 0)
+        {
+            REQUIRE(insert.bind_text("name" + std::to_string(i), 2) == priam::status::ok);
+        }
+        REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+    }
+
+    std::pmr::monotonic_buffer_resource memory_resource{};
+    priam::detached_result              detached{};
+    {
+        priam::statement select{"SELECT key, total, name FROM test_types.test_detached"};
+        auto             result = client->execute_statement(select, 10s);
+        REQUIRE(result.status() == priam::status::ok);
+        detached = result.detach(&memory_resource);
+    }
+
+    REQUIRE(detached.status() == priam::status::ok);
+    REQUIRE(detached.row_count() == 10);
+    REQUIRE(detached.column_count() == 3);
+    REQUIRE(detached.column_name(2) == "name");
+    REQUIRE(detached.column_type(1) == priam::data_type::bigint);
+
+    size_t rows{0};
+    detached.for_each([&](const priam::detached_row& row) {
+        auto key = row.column("key").as_int();
+        REQUIRE(key.has_value());
+        REQUIRE(row.column("total").as_big_int() == int64_t{key.value()} * 1'000'000'000'000);
+        if (key.value() % 2 == 0)
+        {
+            REQUIRE(row.column("name").as_text_view() == "name" + std::to_string(key.value()));
+        }
+        else
+        {
+            REQUIRE(row.column("name").is_null());
+        }
+        ++rows;
+    });
+    REQUIRE(rows == 10);
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("type random access and parallel rows")
+{
+    auto client = make_client();
+
+    create_table(*client, "CREATE TABLE IF NOT EXISTS test_types.test_rows (key int, PRIMARY KEY (key))");
+
+    for (int32_t i = 0; i < 100; ++i)
+    {
+        priam::statement insert{"INSERT INTO test_types.test_rows (key) VALUES (?)"};
+        REQUIRE(insert.bind_int(i, 0) == priam::status::ok);
+        REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+    }
+
+    priam::statement select{"SELECT key FROM test_types.test_rows"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+    REQUIRE(result.row_count() == 100);
+
+    std::vector<int32_t> keys{};
+    result.for_each([&](const priam::row& row) { keys.push_back(row.column("key").as_int().value()); });
+    for (size_t i = 0; i < keys.size(); ++i)
+    {
+        REQUIRE(result.row_at(i).column("key").as_int() == keys[i]);
+    }
+
+    std::vector<std::thread> threads{};
+    std::mutex               threads_mutex{};
+    auto                     executor = [&](auto task) {
+        std::lock_guard<std::mutex> guard{threads_mutex};
+        threads.emplace_back(std::move(task));
+    };
+
+    std::atomic<int64_t> sum{0};
+    std::atomic<size_t>  rows{0};
+    result.parallel_for_each(
+        executor,
+        [&](const priam::detached_row& row) {
+            sum += row.column("key").as_int().value();
+            ++rows;
+        },
+        4);
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    REQUIRE(rows == 100);
+    REQUIRE(sum == 99 * 100 / 2);
+
+    drop_keyspace(*client);
+}
+
+TEST_CASE("type row and column ranges")
+{
+    auto client = make_client();
+
+    create_table(*client, "CREATE TABLE IF NOT EXISTS test_types.test_ranges (key int, name text, PRIMARY KEY (key))");
+
+    for (int32_t i = 0; i < 10; ++i)
+    {
+        priam::statement insert{"INSERT INTO test_types.test_ranges (key, name) VALUES (?, ?)"};
+        REQUIRE(insert.bind_int(i, 0) == priam::status::ok);
+        if (i % 2 == 0)
+        {
+            REQUIRE(insert.bind_text("name" + std::to_string(i), 1) == priam::status::ok);
+        }
+        REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+    }
+
+    priam::statement select{"SELECT key, name FROM test_types.test_ranges"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+
+    size_t rows{0};
+    for (const auto& row : result)
+    {
+        size_t columns{0};
+        for (const auto& value : row)
+        {
+            REQUIRE((columns != 0 || !value.is_null()));
+            ++columns;
+        }
+        REQUIRE(columns == 2);
+        ++rows;
+    }
+    REQUIRE(rows == 10);
+
+    drop_keyspace(*client);
+}
+
+// Vector columns need Cassandra 5, run with the [cassandra5] tag.
+TEST_CASE("type vector", "[.][cassandra5]")
+{
+    auto client = make_client();
+
+    create_table(
+        *client,
+        "CREATE TABLE IF NOT EXISTS test_types.test_vector (key int, embedding vector<float, 768>, PRIMARY KEY (key))");
+
+    std::array<float, 768> embedding{};
+    for (size_t i = 0; i < embedding.size(); ++i)
+    {
+        embedding[i] = static_cast<float>(i) * 0.25f;
+    }
+
+    priam::statement insert{"INSERT INTO test_types.test_vector (key, embedding) VALUES (?, ?)"};
+    REQUIRE(insert.bind_int(1, 0) == priam::status::ok);
+    REQUIRE(insert.bind_vector(embedding, 1) == priam::status::ok);
+    REQUIRE(client->execute_statement(insert, 10s).status() == priam::status::ok);
+
+    priam::statement select{"SELECT embedding FROM test_types.test_vector WHERE key = 1"};
+    auto             result = client->execute_statement(select, 10s);
+    REQUIRE(result.status() == priam::status::ok);
+    REQUIRE(result.row_count() == 1);
+
+    std::array<float, 768> decoded{};
+    REQUIRE(result.first_row().column("embedding").as_vector(decoded) == std::optional<size_t>{768});
+    REQUIRE(decoded == embedding);
+
+    drop_keyspace(*client);
+}
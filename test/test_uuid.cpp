@@ -0,0 +1,99 @@
+#include "catch.hpp"
+
+#include <priam/priam.hpp>
+
+#include <cinttypes>
+#include <cstdio>
+#include <random>
+#include <string>
+
+namespace
+{
+auto make_uuid(uint64_t time_and_version, uint64_t clock_seq_and_node) -> priam::uuid
+{
+    priam::uuid output{};
+    output.time_and_version   = time_and_version;
+    output.clock_seq_and_node = clock_seq_and_node;
+    return output;
+}
+
+/**
+ * The formatting the driver's cass_uuid_string() uses.
+ */
+auto reference_string(const priam::uuid& value) -> std::string
+{
+    char buffer[priam::uuid_string_length + 1];
+    std::snprintf(
+        buffer,
+        sizeof(buffer),
+        "%08x-%04x-%04x-%04x-%012" PRIx64,
+        static_cast<unsigned>(value.time_and_version & 0xFFFFFFFF),
+        static_cast<unsigned>((value.time_and_version >> 32) & 0xFFFF),
+        static_cast<unsigned>((value.time_and_version >> 48) & 0xFFFF),
+        static_cast<unsigned>((value.clock_seq_and_node >> 48) & 0xFFFF),
+        value.clock_seq_and_node & 0x0000FFFFFFFFFFFF);
+    return std::string{buffer};
+}
+
+} // namespace
+
+TEST_CASE("uuid to_chars")
+{
+    auto value = make_uuid(0x11d3bfde63b00000, 0x8123456789abcdef);
+
+    char  buffer[priam::uuid_string_length];
+    auto* last = priam::to_chars(buffer, value);
+    REQUIRE(last == buffer + priam::uuid_string_length);
+    REQUIRE(std::string(buffer, last) == "63b00000-bfde-11d3-8123-456789abcdef");
+    REQUIRE(priam::to_string(value) == "63b00000-bfde-11d3-8123-456789abcdef");
+    REQUIRE(priam::to_string(make_uuid(0, 0)) == "00000000-0000-0000-0000-000000000000");
+    REQUIRE(priam::to_string(make_uuid(UINT64_MAX, UINT64_MAX)) == "ffffffff-ffff-ffff-ffff-ffffffffffff");
+}
+
+TEST_CASE("uuid from_chars")
+{
+    priam::uuid value{};
+    REQUIRE(priam::from_chars("63b00000-bfde-11d3-8123-456789abcdef", value));
+    REQUIRE(value.time_and_version == 0x11d3bfde63b00000);
+    REQUIRE(value.clock_seq_and_node == 0x8123456789abcdef);
+
+    REQUIRE(priam::from_chars("63B00000-BFDE-11D3-8123-456789ABCDEF", value));
+    REQUIRE(value.time_and_version == 0x11d3bfde63b00000);
+    REQUIRE(value.clock_seq_and_node == 0x8123456789abcdef);
+}
+
+TEST_CASE("uuid from_chars rejects malformed input")
+{
+    auto        expected = make_uuid(1, 2);
+    priam::uuid value    = expected;
+
+    REQUIRE_FALSE(priam::from_chars("", value));
+    REQUIRE_FALSE(priam::from_chars("63b00000-bfde-11d3-8123-456789abcde", value));
+    REQUIRE_FALSE(priam::from_chars("63b00000-bfde-11d3-8123-456789abcdef0", value));
+    REQUIRE_FALSE(priam::from_chars("63b00000bfde-11d3-8123-456789abcdef0", value));
+    REQUIRE_FALSE(priam::from_chars("63b00000-bfde-11d3-8123-456789abcdeg", value));
+    REQUIRE_FALSE(priam::from_chars("g3b00000-bfde-11d3-8123-456789abcdef", value));
+    REQUIRE_FALSE(priam::from_chars("63b00000-bfde-11d3-8123-456789abcd:f", value));
+    REQUIRE_FALSE(priam::from_chars("63b00000-bfde-11d3-8123-456789abcd@f", value));
+    REQUIRE_FALSE(priam::from_chars("63b00000-bfde-11d3-8123-456789abcd\xe6" "f", value));
+
+    // The output is untouched on failure.
+    REQUIRE(value.time_and_version == expected.time_and_version);
+    REQUIRE(value.clock_seq_and_node == expected.clock_seq_and_node);
+}
+
+TEST_CASE("uuid to_chars and from_chars round trip")
+{
+    std::mt19937_64 random{42};
+    for (size_t i = 0; i < 1000; ++i)
+    {
+        auto value     = make_uuid(random(), random());
+        auto formatted = priam::to_string(value);
+        REQUIRE(formatted == reference_string(value));
+
+        priam::uuid parsed{};
+        REQUIRE(priam::from_chars(formatted, parsed));
+        REQUIRE(parsed.time_and_version == value.time_and_version);
+        REQUIRE(parsed.clock_seq_and_node == value.clock_seq_and_node);
+    }
+}
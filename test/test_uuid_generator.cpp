@@ -3,6 +3,22 @@
 #include <priam/priam.hpp>
 
 #include <iostream>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+/**
+ * @return The uuid v1 timestamp, 100ns intervals since the gregorian epoch.
+ */
+auto v1_timestamp(const priam::uuid& uuid) -> uint64_t
+{
+    return uuid.time_and_version & 0x0FFFFFFFFFFFFFFF;
+}
+
+} // namespace
 
 TEST_CASE("uuid_generator uuid_v1")
 {
@@ -55,3 +71,91 @@ TEST_CASE("uuid_generator uuid_v4")
     REQUIRE(uuid_str.length() == 36);
     REQUIRE(uuid_str[uuid_str.length()] == '\0');
 }
+
+TEST_CASE("thread_uuid_generator uuid_v1")
+{
+    auto uuid     = priam::thread_uuid_generator::uuid_v1();
+    auto uuid_str = priam::to_string(uuid);
+
+    REQUIRE(uuid_str.length() == 36);
+    REQUIRE(uuid_str[14] == '1');
+    REQUIRE((uuid.clock_seq_and_node >> 62) == 0b10);
+    // The random node has the multicast bit set.
+    REQUIRE((uuid.clock_seq_and_node & 0x010000000000) != 0);
+}
+
+TEST_CASE("thread_uuid_generator uuid_v1 is monotonic")
+{
+    auto previous = priam::thread_uuid_generator::uuid_v1();
+    for (size_t i = 0; i < 10'000; ++i)
+    {
+        auto next = priam::thread_uuid_generator::uuid_v1();
+        REQUIRE(v1_timestamp(next) > v1_timestamp(previous));
+        REQUIRE(next.clock_seq_and_node == previous.clock_seq_and_node);
+        previous = next;
+    }
+}
+
+TEST_CASE("thread_uuid_generator uuid_v7 is monotonic")
+{
+    auto previous = priam::to_string(priam::thread_uuid_generator::uuid_v7());
+    REQUIRE(previous[14] == '7');
+    REQUIRE(std::string{"89ab"}.find(previous[19]) != std::string::npos);
+
+    for (size_t i = 0; i < 10'000; ++i)
+    {
+        auto next = priam::to_string(priam::thread_uuid_generator::uuid_v7());
+        REQUIRE(next > previous);
+        previous = next;
+    }
+}
+
+TEST_CASE("thread_uuid_generator generate")
+{
+    std::vector<priam::uuid> v1s(10'000);
+    priam::thread_uuid_generator::generate(v1s);
+    for (size_t i = 1; i < v1s.size(); ++i)
+    {
+        REQUIRE(v1_timestamp(v1s[i]) == v1_timestamp(v1s[i - 1]) + 1);
+    }
+    // Later uuids continue after the batch.
+    REQUIRE(v1_timestamp(priam::thread_uuid_generator::uuid_v1()) > v1_timestamp(v1s.back()));
+
+    std::vector<priam::uuid> v7s(10'000);
+    priam::thread_uuid_generator::generate(v7s.data(), v7s.size(), priam::thread_uuid_generator::version::v7);
+    for (size_t i = 1; i < v7s.size(); ++i)
+    {
+        REQUIRE(priam::to_string(v7s[i]) > priam::to_string(v7s[i - 1]));
+    }
+}
+
+TEST_CASE("thread_uuid_generator is unique across threads")
+{
+    constexpr size_t thread_count = 8;
+    constexpr size_t per_thread   = 10'000;
+
+    std::vector<std::vector<priam::uuid>> uuids(thread_count, std::vector<priam::uuid>(per_thread));
+    std::vector<std::thread>              threads{};
+    for (size_t t = 0; t < thread_count; ++t)
+    {
+        threads.emplace_back([&uuids, t]() {
+            auto version = (t % 2 == 0) ? priam::thread_uuid_generator::version::v1
+                                        : priam::thread_uuid_generator::version::v7;
+            priam::thread_uuid_generator::generate(uuids[t], version);
+        });
+    }
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+
+    std::set<std::string> unique{};
+    for (const auto& batch : uuids)
+    {
+        for (const auto& uuid : batch)
+        {
+            unique.insert(priam::to_string(uuid));
+        }
+    }
+    REQUIRE(unique.size() == thread_count * per_thread);
+}
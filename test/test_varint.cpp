@@ -0,0 +1,124 @@
+#include "catch.hpp"
+
+#include <priam/priam.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace
+{
+auto bytes_of(const priam::varint& value) -> std::vector<uint8_t>
+{
+    std::vector<uint8_t> output{};
+    for (size_t i = 0; i < value.size(); ++i)
+    {
+        output.push_back(std::to_integer<uint8_t>(value.data()[i]));
+    }
+    return output;
+}
+
+} // namespace
+
+TEST_CASE("varint encodes two's complement in the fewest bytes")
+{
+    REQUIRE(bytes_of(priam::varint{}) == std::vector<uint8_t>{0x00});
+    REQUIRE(bytes_of(priam::varint{int64_t{127}}) == std::vector<uint8_t>{0x7F});
+    REQUIRE(bytes_of(priam::varint{int64_t{128}}) == std::vector<uint8_t>{0x00, 0x80});
+    REQUIRE(bytes_of(priam::varint{int64_t{-1}}) == std::vector<uint8_t>{0xFF});
+    REQUIRE(bytes_of(priam::varint{int64_t{-128}}) == std::vector<uint8_t>{0x80});
+    REQUIRE(bytes_of(priam::varint{int64_t{-129}}) == std::vector<uint8_t>{0xFF, 0x7F});
+
+    // Redundant sign bytes from the wire are dropped.
+    std::byte padded[] = {std::byte{0xFF}, std::byte{0xFF}, std::byte{0x80}};
+    REQUIRE(priam::varint{padded, 3} == priam::varint{int64_t{-128}});
+    REQUIRE(priam::varint{nullptr, 0} == priam::varint{});
+}
+
+TEST_CASE("varint converts to integers when they fit")
+{
+    REQUIRE(priam::varint{INT64_MIN}.to_int64() == INT64_MIN);
+    REQUIRE(priam::varint{INT64_MAX}.to_int64() == INT64_MAX);
+
+    priam::int128_t beyond_int64 = static_cast<priam::int128_t>(INT64_MAX) + 1;
+    REQUIRE_FALSE(priam::varint{beyond_int64}.to_int64().has_value());
+    REQUIRE(priam::varint{beyond_int64}.to_int128() == beyond_int64);
+
+    auto huge = priam::varint::from_string("1" + std::string(40, '0'));
+    REQUIRE(huge.has_value());
+    REQUIRE_FALSE(huge.value().to_int128().has_value());
+    REQUIRE(huge.value().to_double() == Approx(1e40));
+}
+
+TEST_CASE("varint to_string and from_string round trip")
+{
+    std::vector<std::string> values{
+        "0",
+        "1",
+        "-1",
+        "9223372036854775807",
+        "-9223372036854775808",
+        "170141183460469231731687303715884105727",
+        "-170141183460469231731687303715884105728",
+        "170141183460469231731687303715884105728",
+        "-123456789012345678901234567890123456789012345678901234567890",
+        "1000000000000000000000000000000000000000000000000000000000000"};
+
+    for (const auto& value : values)
+    {
+        auto parsed = priam::varint::from_string(value);
+        REQUIRE(parsed.has_value());
+        REQUIRE(parsed.value().to_string() == value);
+    }
+
+    REQUIRE(priam::varint::from_string("+42").value().to_string() == "42");
+    REQUIRE(priam::varint::from_string("-0").value() == priam::varint{});
+    REQUIRE(priam::varint::from_string("000123").value().to_int64() == 123);
+    REQUIRE_FALSE(priam::varint::from_string("").has_value());
+    REQUIRE_FALSE(priam::varint::from_string("-").has_value());
+    REQUIRE_FALSE(priam::varint::from_string("12a").has_value());
+    REQUIRE_FALSE(priam::varint::from_string("1.5").has_value());
+}
+
+TEST_CASE("decimal to_string")
+{
+    REQUIRE(priam::decimal{priam::varint{int64_t{12345}}, 2}.to_string() == "123.45");
+    REQUIRE(priam::decimal{priam::varint{int64_t{-12345}}, 2}.to_string() == "-123.45");
+    REQUIRE(priam::decimal{priam::varint{int64_t{5}}, 3}.to_string() == "0.005");
+    REQUIRE(priam::decimal{priam::varint{int64_t{-5}}, 3}.to_string() == "-0.005");
+    REQUIRE(priam::decimal{priam::varint{int64_t{100}}, 2}.to_string() == "1.00");
+    REQUIRE(priam::decimal{priam::varint{int64_t{15}}, -2}.to_string() == "1500");
+    REQUIRE(priam::decimal{priam::varint{int64_t{0}}, -2}.to_string() == "0");
+    REQUIRE(priam::decimal{}.to_string() == "0");
+}
+
+TEST_CASE("decimal from_string")
+{
+    auto value = priam::decimal::from_string("-1234.5678");
+    REQUIRE(value.has_value());
+    REQUIRE(value.value().varint().to_int64() == -12345678);
+    REQUIRE(value.value().scale() == 4);
+    REQUIRE(value.value().to_string() == "-1234.5678");
+
+    REQUIRE(priam::decimal::from_string("1.5E-3").value().to_string() == "0.0015");
+    REQUIRE(priam::decimal::from_string("1.5e3").value().scale() == -2);
+    REQUIRE(priam::decimal::from_string(".5").value().to_string() == "0.5");
+    REQUIRE(priam::decimal::from_string("5.").value().to_string() == "5");
+
+    auto precise = "12345678901234567890123456789.123456789012345678901234567890";
+    REQUIRE(priam::decimal::from_string(precise).value().to_string() == precise);
+
+    REQUIRE_FALSE(priam::decimal::from_string("").has_value());
+    REQUIRE_FALSE(priam::decimal::from_string(".").has_value());
+    REQUIRE_FALSE(priam::decimal::from_string("1e").has_value());
+    REQUIRE_FALSE(priam::decimal::from_string("1.2.3").has_value());
+    REQUIRE_FALSE(priam::decimal::from_string("1e99999999999").has_value());
+}
+
+TEST_CASE("decimal to_double")
+{
+    REQUIRE(priam::decimal::from_string("0.1").value().to_double() == 0.1);
+    REQUIRE(priam::decimal::from_string("-123.456").value().to_double() == -123.456);
+    REQUIRE(priam::decimal::from_string("1.5e10").value().to_double() == 1.5e10);
+    REQUIRE(priam::decimal::from_string("1" + std::string(30, '0') + ".5").value().to_double() == Approx(1e30));
+}